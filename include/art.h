@@ -0,0 +1,74 @@
+/**
+ * @file art.h
+ * @brief Adaptive Radix Tree (ART) for integer keys
+ * @author [Your Name]
+ * @date 2024
+ * @license MIT
+ *
+ * Alternative engine for the ordered-set operations of bst.h. Keys are
+ * split into bytes and stored in Node4/16/48/256 inner nodes with path
+ * compression, so a lookup passes at most four inner nodes and one leaf
+ * regardless of the number of keys. Every inner node keeps the number of
+ * keys below it, so kth and rank queries also visit at most four inner
+ * nodes, scanning up to 256 child slots in each: a constant bound.
+ */
+
+#ifndef ADAPTIVE_RADIX_TREE_H
+#define ADAPTIVE_RADIX_TREE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+
+/**
+ * @struct ARTNode
+ * @brief Opaque node of an Adaptive Radix Tree (leaf or inner node)
+ */
+typedef struct ARTNode ARTNode;
+
+/**
+ * @struct ART
+ * @brief Structure representing an Adaptive Radix Tree
+ */
+typedef struct {
+    ARTNode* root;              ///< Root of the ART
+    int size;                   ///< Number of keys in ART
+} ART;
+
+// ==================== TREE CREATION & DESTRUCTION ====================
+
+ART* art_create();
+void art_destroy(ART* tree);
+void art_clear(ART* tree);
+
+// ==================== INSERTION & DELETION ====================
+
+bool art_insert(ART* tree, int value);
+bool art_delete(ART* tree, int value);
+
+// ==================== SEARCH OPERATIONS ====================
+
+bool art_search(const ART* tree, int value);
+bool art_contains(const ART* tree, int value);
+
+// ==================== TRAVERSAL OPERATIONS ====================
+
+void art_inorder(const ART* tree, void (*callback)(int));
+void art_range(const ART* tree, int low, int high, void (*callback)(int));
+
+// ==================== UTILITY OPERATIONS ====================
+
+int art_min(const ART* tree);
+int art_max(const ART* tree);
+int art_size(const ART* tree);
+bool art_is_empty(const ART* tree);
+
+// ==================== ADVANCED OPERATIONS ====================
+
+int art_kth_smallest(const ART* tree, int k);
+int art_kth_largest(const ART* tree, int k);
+int art_rank(const ART* tree, int value);
+int art_count_range(const ART* tree, int low, int high);
+
+#endif // ADAPTIVE_RADIX_TREE_H
@@ -13,6 +13,8 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <limits.h>
+#include <stdint.h>
+#include <stddef.h>
 
 /**
  * @struct BSTNode
@@ -22,8 +24,31 @@ typedef struct BSTNode {
     int data;                   ///< Data stored in node
     struct BSTNode* left;       ///< Pointer to left child
     struct BSTNode* right;      ///< Pointer to right child
+    struct BSTNode* parent;     ///< Pointer to parent (NULL for root)
 } BSTNode;
 
+/**
+ * @struct BSTFilter
+ * @brief Opaque negative-lookup filter attached to a BST
+ */
+typedef struct BSTFilter BSTFilter;
+
+/**
+ * @struct BSTFilterStats
+ * @brief Configuration and effectiveness report for a BSTFilter
+ */
+typedef struct {
+    size_t memory_bytes;        ///< Bytes used by the counter blocks
+    int num_hashes;             ///< Counters touched per key
+    int capacity;               ///< Number of keys the filter was sized for
+    double target_fpr;          ///< Requested false-positive rate
+    double estimated_fpr;       ///< Expected false-positive rate at current size
+    double observed_fpr;        ///< Measured fraction of misses let through
+    unsigned long long lookups;          ///< Lookups that probed the filter
+    unsigned long long rejected;         ///< Lookups answered by the filter
+    unsigned long long false_positives;  ///< Passed the filter but missed
+} BSTFilterStats;
+
 /**
  * @struct BST
  * @brief Structure representing Binary Search Tree
@@ -31,6 +56,11 @@ typedef struct BSTNode {
 typedef struct {
     BSTNode* root;              ///< Root of the BST
     int size;                   ///< Number of nodes in BST
+    BSTNode* finger;            ///< Last accessed node for finger search
+    BSTNode* min_node;          ///< Cached node holding the minimum
+    BSTNode* max_node;          ///< Cached node holding the maximum
+    BSTFilter* filter;          ///< Optional negative-lookup filter
+    bool hashed;                ///< Nodes carry subtree digests
 } BST;
 
 // ==================== TREE CREATION & DESTRUCTION ====================
@@ -51,12 +81,31 @@ bool bst_delete(BST* tree, int value);
 BSTNode* bst_delete_node(BSTNode* root, int value, bool* success);
 bool bst_remove_min(BST* tree, int* min_value);
 bool bst_remove_max(BST* tree, int* max_value);
+int bst_pop_min_n(BST* tree, int* out, int n);
+int bst_pop_max_n(BST* tree, int* out, int n);
 
 // ==================== SEARCH OPERATIONS ====================
 
 bool bst_search(const BST* tree, int value);
 BSTNode* bst_find_node(const BSTNode* root, int value);
 bool bst_contains(const BST* tree, int value);
+bool bst_finger_search(BST* tree, int value);
+BSTNode* bst_finger_find(BST* tree, int value);
+
+// ==================== MEMBERSHIP FILTER ====================
+
+bool bst_filter_enable(BST* tree, int capacity, double target_fpr);
+void bst_filter_disable(BST* tree);
+bool bst_filter_stats(const BST* tree, BSTFilterStats* stats);
+
+// ==================== ORDER QUERIES ====================
+
+bool bst_floor(const BST* tree, int value, int* result);
+bool bst_ceiling(const BST* tree, int value, int* result);
+bool bst_predecessor(const BST* tree, int value, int* result);
+bool bst_successor(const BST* tree, int value, int* result);
+BSTNode* bst_node_predecessor(const BSTNode* node);
+BSTNode* bst_node_successor(const BSTNode* node);
 
 // ==================== TRAVERSAL OPERATIONS ====================
 
@@ -83,6 +132,47 @@ bool bst_is_balanced(const BST* tree);
 BST* bst_clone(const BST* tree);
 bool bst_equals(const BST* tree1, const BST* tree2);
 
+// ==================== SUBTREE HASHES ====================
+// A subtree digest is the sum of a per-key hash over the subtree, so equal
+// key sets have equal digests whatever the shape of the trees holding them.
+// Keys are hashed with a per-process seed, so digests differ between runs.
+//
+// When both trees are hashed, bst_equals and bst_diff trust matching digests
+// and are probabilistic: different key sets collide with a chance of about
+// 2^-64. The seed keeps collisions from being chosen in advance, but the
+// digest is a checksum, not a cryptographic MAC.
+//
+// Digests are stored in enlarged nodes that exist only while hashing is on.
+// bst_hash_enable and bst_hash_disable move every node, which invalidates
+// all BSTNode pointers held by the caller, including those returned by
+// bst_find_node and bst_finger_find. The raw node functions bst_insert_node
+// and bst_delete_node know nothing of digests and must not be used on the
+// nodes of a hashed tree.
+
+bool bst_hash_enable(BST* tree);
+void bst_hash_disable(BST* tree);
+uint64_t bst_hash(const BST* tree);
+int bst_diff(const BST* tree1, const BST* tree2,
+             void (*callback)(int, bool, void*), void* ctx);
+
+// ==================== PARALLEL OPERATIONS ====================
+// Subtrees are forked across a work-stealing thread pool. Visiting order is
+// unspecified and callbacks run concurrently, so they must be thread-safe.
+// A num_threads of 0 or less uses every online CPU. bst_parallel_for_each
+// returns false when it ran out of memory, in which case the callback may
+// have seen only some of the keys; the other operations fall back to their
+// sequential versions instead.
+
+bool bst_parallel_for_each(const BST* tree, void (*callback)(int, void*),
+                           void* ctx, int num_threads);
+long long bst_parallel_reduce(const BST* tree, long long identity,
+                              long long (*map)(int, void*),
+                              long long (*combine)(long long, long long),
+                              void* ctx, int num_threads);
+int bst_parallel_height(const BST* tree, int num_threads);
+bool bst_parallel_is_valid(const BST* tree, int num_threads);
+bool bst_parallel_is_balanced(const BST* tree, int num_threads);
+
 // ==================== SERIALIZATION ====================
 
 void bst_serialize(const BST* tree, FILE* stream);
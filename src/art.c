@@ -0,0 +1,826 @@
+/**
+ * @file art.c
+ * @brief Adaptive Radix Tree Implementation
+ */
+
+#include "art.h"
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define ART_KEY_BYTES 4
+
+typedef enum {
+    ART_LEAF,
+    ART_NODE4,
+    ART_NODE16,
+    ART_NODE48,
+    ART_NODE256
+} ARTNodeType;
+
+// Common header of every node. Leaves only use type.
+struct ARTNode {
+    uint8_t type;
+    uint8_t prefix_len;                  // Compressed path length in bytes
+    uint16_t num_children;
+    int count;                           // Number of keys below this node
+    uint8_t prefix[ART_KEY_BYTES];
+};
+
+typedef struct {
+    ARTNode header;
+    uint32_t key;                        // Encoded key (see encode_key)
+} ARTLeaf;
+
+typedef struct {
+    ARTNode header;
+    uint8_t keys[4];
+    ARTNode* children[4];
+} ARTNode4;
+
+typedef struct {
+    ARTNode header;
+    uint8_t keys[16];
+    ARTNode* children[16];
+} ARTNode16;
+
+typedef struct {
+    ARTNode header;
+    uint8_t child_index[256];            // Slot + 1, or 0 when empty
+    ARTNode* children[48];
+} ARTNode48;
+
+typedef struct {
+    ARTNode header;
+    ARTNode* children[256];
+} ARTNode256;
+
+// ==================== INTERNAL HELPER FUNCTIONS ====================
+
+// Flip the sign bit so that unsigned byte order matches signed int order
+static uint32_t encode_key(int value) {
+    return (uint32_t)value ^ 0x80000000u;
+}
+
+static int decode_key(uint32_t key) {
+    return (int)(key ^ 0x80000000u);
+}
+
+static uint8_t key_byte(uint32_t key, int depth) {
+    return (uint8_t)(key >> (24 - 8 * depth));
+}
+
+static bool is_leaf(const ARTNode* node) {
+    return node->type == ART_LEAF;
+}
+
+static uint32_t leaf_key(const ARTNode* node) {
+    return ((const ARTLeaf*)node)->key;
+}
+
+static int node_count(const ARTNode* node) {
+    if (!node) return 0;
+    return is_leaf(node) ? 1 : node->count;
+}
+
+static ARTNode* create_leaf(uint32_t key) {
+    ARTLeaf* leaf = (ARTLeaf*)calloc(1, sizeof(ARTLeaf));
+    if (!leaf) return NULL;
+
+    leaf->header.type = ART_LEAF;
+    leaf->key = key;
+    return (ARTNode*)leaf;
+}
+
+static ARTNode* create_inner(ARTNodeType type) {
+    size_t size = 0;
+    switch (type) {
+        case ART_NODE4:   size = sizeof(ARTNode4); break;
+        case ART_NODE16:  size = sizeof(ARTNode16); break;
+        case ART_NODE48:  size = sizeof(ARTNode48); break;
+        case ART_NODE256: size = sizeof(ARTNode256); break;
+        default: return NULL;
+    }
+
+    ARTNode* node = (ARTNode*)calloc(1, size);
+    if (!node) return NULL;
+
+    node->type = (uint8_t)type;
+    return node;
+}
+
+static void copy_header(ARTNode* dst, const ARTNode* src) {
+    dst->prefix_len = src->prefix_len;
+    dst->num_children = src->num_children;
+    dst->count = src->count;
+    memcpy(dst->prefix, src->prefix, ART_KEY_BYTES);
+}
+
+static void destroy_subtree(ARTNode* node) {
+    if (!node) return;
+
+    switch (node->type) {
+        case ART_NODE4: {
+            ARTNode4* n = (ARTNode4*)node;
+            for (int i = 0; i < node->num_children; i++) {
+                destroy_subtree(n->children[i]);
+            }
+            break;
+        }
+        case ART_NODE16: {
+            ARTNode16* n = (ARTNode16*)node;
+            for (int i = 0; i < node->num_children; i++) {
+                destroy_subtree(n->children[i]);
+            }
+            break;
+        }
+        case ART_NODE48: {
+            ARTNode48* n = (ARTNode48*)node;
+            for (int i = 0; i < 48; i++) {
+                destroy_subtree(n->children[i]);
+            }
+            break;
+        }
+        case ART_NODE256: {
+            ARTNode256* n = (ARTNode256*)node;
+            for (int i = 0; i < 256; i++) {
+                destroy_subtree(n->children[i]);
+            }
+            break;
+        }
+    }
+    free(node);
+}
+
+// Number of prefix bytes of node that match key starting at depth
+static int prefix_match(const ARTNode* node, uint32_t key, int depth) {
+    for (int i = 0; i < node->prefix_len; i++) {
+        if (node->prefix[i] != key_byte(key, depth + i)) return i;
+    }
+    return node->prefix_len;
+}
+
+// ==================== CHILD LOOKUP ====================
+
+static ARTNode** find_child(ARTNode* node, uint8_t byte) {
+    switch (node->type) {
+        case ART_NODE4: {
+            ARTNode4* n = (ARTNode4*)node;
+            for (int i = 0; i < node->num_children; i++) {
+                if (n->keys[i] == byte) return &n->children[i];
+            }
+            return NULL;
+        }
+        case ART_NODE16: {
+            ARTNode16* n = (ARTNode16*)node;
+#if defined(__SSE2__)
+            // Compare all 16 keys at once
+            __m128i cmp = _mm_cmpeq_epi8(_mm_set1_epi8((char)byte),
+                                         _mm_loadu_si128((const __m128i*)n->keys));
+            int mask = _mm_movemask_epi8(cmp) & ((1 << node->num_children) - 1);
+            return mask ? &n->children[__builtin_ctz(mask)] : NULL;
+#else
+            for (int i = 0; i < node->num_children; i++) {
+                if (n->keys[i] == byte) return &n->children[i];
+            }
+            return NULL;
+#endif
+        }
+        case ART_NODE48: {
+            ARTNode48* n = (ARTNode48*)node;
+            int slot = n->child_index[byte];
+            return slot ? &n->children[slot - 1] : NULL;
+        }
+        case ART_NODE256: {
+            ARTNode256* n = (ARTNode256*)node;
+            return n->children[byte] ? &n->children[byte] : NULL;
+        }
+    }
+    return NULL;
+}
+
+// Visit children in key order; stops early when visit returns false
+static void for_each_child(ARTNode* node,
+                           bool (*visit)(uint8_t, ARTNode*, void*),
+                           void* ctx) {
+    switch (node->type) {
+        case ART_NODE4: {
+            ARTNode4* n = (ARTNode4*)node;
+            for (int i = 0; i < node->num_children; i++) {
+                if (!visit(n->keys[i], n->children[i], ctx)) return;
+            }
+            break;
+        }
+        case ART_NODE16: {
+            ARTNode16* n = (ARTNode16*)node;
+            for (int i = 0; i < node->num_children; i++) {
+                if (!visit(n->keys[i], n->children[i], ctx)) return;
+            }
+            break;
+        }
+        case ART_NODE48: {
+            ARTNode48* n = (ARTNode48*)node;
+            for (int b = 0; b < 256; b++) {
+                int slot = n->child_index[b];
+                if (slot && !visit((uint8_t)b, n->children[slot - 1], ctx)) return;
+            }
+            break;
+        }
+        case ART_NODE256: {
+            ARTNode256* n = (ARTNode256*)node;
+            for (int b = 0; b < 256; b++) {
+                if (n->children[b] && !visit((uint8_t)b, n->children[b], ctx)) return;
+            }
+            break;
+        }
+    }
+}
+
+static ARTNode* first_child(ARTNode* node) {
+    switch (node->type) {
+        case ART_NODE4:  return ((ARTNode4*)node)->children[0];
+        case ART_NODE16: return ((ARTNode16*)node)->children[0];
+        case ART_NODE48: {
+            ARTNode48* n = (ARTNode48*)node;
+            for (int b = 0; b < 256; b++) {
+                if (n->child_index[b]) return n->children[n->child_index[b] - 1];
+            }
+            return NULL;
+        }
+        case ART_NODE256: {
+            ARTNode256* n = (ARTNode256*)node;
+            for (int b = 0; b < 256; b++) {
+                if (n->children[b]) return n->children[b];
+            }
+            return NULL;
+        }
+    }
+    return NULL;
+}
+
+static ARTNode* last_child(ARTNode* node) {
+    int last = node->num_children - 1;
+    switch (node->type) {
+        case ART_NODE4:  return ((ARTNode4*)node)->children[last];
+        case ART_NODE16: return ((ARTNode16*)node)->children[last];
+        case ART_NODE48: {
+            ARTNode48* n = (ARTNode48*)node;
+            for (int b = 255; b >= 0; b--) {
+                if (n->child_index[b]) return n->children[n->child_index[b] - 1];
+            }
+            return NULL;
+        }
+        case ART_NODE256: {
+            ARTNode256* n = (ARTNode256*)node;
+            for (int b = 255; b >= 0; b--) {
+                if (n->children[b]) return n->children[b];
+            }
+            return NULL;
+        }
+    }
+    return NULL;
+}
+
+// ==================== NODE GROWTH ====================
+
+// Insert into a sorted key/child array with room for one more entry
+static void sorted_insert(uint8_t* keys, ARTNode** children, int n,
+                          uint8_t byte, ARTNode* child) {
+    int pos = 0;
+    while (pos < n && keys[pos] < byte) pos++;
+
+    memmove(keys + pos + 1, keys + pos, (size_t)(n - pos));
+    memmove(children + pos + 1, children + pos,
+            (size_t)(n - pos) * sizeof(ARTNode*));
+    keys[pos] = byte;
+    children[pos] = child;
+}
+
+// Add child under byte, replacing *ref by a larger node when full
+static bool add_child(ARTNode** ref, uint8_t byte, ARTNode* child) {
+    ARTNode* node = *ref;
+
+    switch (node->type) {
+        case ART_NODE4: {
+            ARTNode4* n = (ARTNode4*)node;
+            if (node->num_children < 4) {
+                sorted_insert(n->keys, n->children, node->num_children, byte, child);
+                node->num_children++;
+                return true;
+            }
+
+            ARTNode16* grown = (ARTNode16*)create_inner(ART_NODE16);
+            if (!grown) return false;
+            copy_header(&grown->header, node);
+            memcpy(grown->keys, n->keys, 4);
+            memcpy(grown->children, n->children, 4 * sizeof(ARTNode*));
+            free(node);
+            *ref = (ARTNode*)grown;
+            return add_child(ref, byte, child);
+        }
+        case ART_NODE16: {
+            ARTNode16* n = (ARTNode16*)node;
+            if (node->num_children < 16) {
+                sorted_insert(n->keys, n->children, node->num_children, byte, child);
+                node->num_children++;
+                return true;
+            }
+
+            ARTNode48* grown = (ARTNode48*)create_inner(ART_NODE48);
+            if (!grown) return false;
+            copy_header(&grown->header, node);
+            for (int i = 0; i < 16; i++) {
+                grown->children[i] = n->children[i];
+                grown->child_index[n->keys[i]] = (uint8_t)(i + 1);
+            }
+            free(node);
+            *ref = (ARTNode*)grown;
+            return add_child(ref, byte, child);
+        }
+        case ART_NODE48: {
+            ARTNode48* n = (ARTNode48*)node;
+            if (node->num_children < 48) {
+                int slot = 0;
+                while (n->children[slot]) slot++;
+                n->children[slot] = child;
+                n->child_index[byte] = (uint8_t)(slot + 1);
+                node->num_children++;
+                return true;
+            }
+
+            ARTNode256* grown = (ARTNode256*)create_inner(ART_NODE256);
+            if (!grown) return false;
+            copy_header(&grown->header, node);
+            for (int b = 0; b < 256; b++) {
+                if (n->child_index[b]) {
+                    grown->children[b] = n->children[n->child_index[b] - 1];
+                }
+            }
+            free(node);
+            *ref = (ARTNode*)grown;
+            return add_child(ref, byte, child);
+        }
+        case ART_NODE256: {
+            ARTNode256* n = (ARTNode256*)node;
+            n->children[byte] = child;
+            node->num_children++;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ==================== NODE SHRINKING ====================
+
+// Replace a Node4 with a single child by that child, merging prefixes
+static void collapse_node4(ARTNode** ref) {
+    ARTNode4* n = (ARTNode4*)*ref;
+    ARTNode* child = n->children[0];
+
+    if (!is_leaf(child)) {
+        uint8_t prefix[ART_KEY_BYTES];
+        int len = n->header.prefix_len;
+        memcpy(prefix, n->header.prefix, (size_t)len);
+        prefix[len++] = n->keys[0];
+        memcpy(prefix + len, child->prefix, (size_t)child->prefix_len);
+        len += child->prefix_len;
+
+        memcpy(child->prefix, prefix, (size_t)len);
+        child->prefix_len = (uint8_t)len;
+    }
+
+    free(n);
+    *ref = child;
+}
+
+// Remove the (now empty) child under byte, shrinking *ref when sparse
+static void remove_child(ARTNode** ref, uint8_t byte) {
+    ARTNode* node = *ref;
+
+    switch (node->type) {
+        case ART_NODE4:
+        case ART_NODE16: {
+            uint8_t* keys = node->type == ART_NODE4 ? ((ARTNode4*)node)->keys
+                                                    : ((ARTNode16*)node)->keys;
+            ARTNode** children = node->type == ART_NODE4
+                                 ? ((ARTNode4*)node)->children
+                                 : ((ARTNode16*)node)->children;
+            int pos = 0;
+            while (keys[pos] != byte) pos++;
+
+            int tail = node->num_children - pos - 1;
+            memmove(keys + pos, keys + pos + 1, (size_t)tail);
+            memmove(children + pos, children + pos + 1,
+                    (size_t)tail * sizeof(ARTNode*));
+            node->num_children--;
+
+            if (node->type == ART_NODE4 && node->num_children == 1) {
+                collapse_node4(ref);
+            } else if (node->type == ART_NODE16 && node->num_children == 3) {
+                ARTNode4* shrunk = (ARTNode4*)create_inner(ART_NODE4);
+                if (!shrunk) return;
+                copy_header(&shrunk->header, node);
+                memcpy(shrunk->keys, keys, 3);
+                memcpy(shrunk->children, children, 3 * sizeof(ARTNode*));
+                free(node);
+                *ref = (ARTNode*)shrunk;
+            }
+            break;
+        }
+        case ART_NODE48: {
+            ARTNode48* n = (ARTNode48*)node;
+            n->children[n->child_index[byte] - 1] = NULL;
+            n->child_index[byte] = 0;
+            node->num_children--;
+
+            if (node->num_children == 12) {
+                ARTNode16* shrunk = (ARTNode16*)create_inner(ART_NODE16);
+                if (!shrunk) return;
+                copy_header(&shrunk->header, node);
+                int pos = 0;
+                for (int b = 0; b < 256; b++) {
+                    if (n->child_index[b]) {
+                        shrunk->keys[pos] = (uint8_t)b;
+                        shrunk->children[pos++] = n->children[n->child_index[b] - 1];
+                    }
+                }
+                free(node);
+                *ref = (ARTNode*)shrunk;
+            }
+            break;
+        }
+        case ART_NODE256: {
+            ARTNode256* n = (ARTNode256*)node;
+            n->children[byte] = NULL;
+            node->num_children--;
+
+            if (node->num_children == 40) {
+                ARTNode48* shrunk = (ARTNode48*)create_inner(ART_NODE48);
+                if (!shrunk) return;
+                copy_header(&shrunk->header, node);
+                int slot = 0;
+                for (int b = 0; b < 256; b++) {
+                    if (n->children[b]) {
+                        shrunk->children[slot] = n->children[b];
+                        shrunk->child_index[b] = (uint8_t)(slot + 1);
+                        slot++;
+                    }
+                }
+                free(node);
+                *ref = (ARTNode*)shrunk;
+            }
+            break;
+        }
+    }
+}
+
+// ==================== TREE CREATION & DESTRUCTION ====================
+
+ART* art_create() {
+    ART* tree = (ART*)malloc(sizeof(ART));
+    if (!tree) return NULL;
+
+    tree->root = NULL;
+    tree->size = 0;
+    return tree;
+}
+
+void art_destroy(ART* tree) {
+    if (!tree) return;
+    art_clear(tree);
+    free(tree);
+}
+
+void art_clear(ART* tree) {
+    if (!tree) return;
+    destroy_subtree(tree->root);
+    tree->root = NULL;
+    tree->size = 0;
+}
+
+// ==================== INSERTION & DELETION ====================
+
+static bool insert_recursive(ARTNode** ref, uint32_t key, int depth) {
+    ARTNode* node = *ref;
+
+    if (!node) {
+        *ref = create_leaf(key);
+        return *ref != NULL;
+    }
+
+    // Lazy expansion: split a leaf only once a second key arrives
+    if (is_leaf(node)) {
+        uint32_t existing = leaf_key(node);
+        if (existing == key) return false; // Duplicate value
+
+        ARTNode* leaf = create_leaf(key);
+        ARTNode* split = create_inner(ART_NODE4);
+        if (!leaf || !split) {
+            free(leaf);
+            free(split);
+            return false;
+        }
+
+        int mismatch = depth;
+        while (key_byte(existing, mismatch) == key_byte(key, mismatch)) {
+            split->prefix[mismatch - depth] = key_byte(key, mismatch);
+            mismatch++;
+        }
+        split->prefix_len = (uint8_t)(mismatch - depth);
+        split->count = 2;
+        add_child(&split, key_byte(existing, mismatch), node);
+        add_child(&split, key_byte(key, mismatch), leaf);
+        *ref = split;
+        return true;
+    }
+
+    // Path compression: split the prefix where the key diverges
+    int matched = prefix_match(node, key, depth);
+    if (matched < node->prefix_len) {
+        ARTNode* leaf = create_leaf(key);
+        ARTNode* split = create_inner(ART_NODE4);
+        if (!leaf || !split) {
+            free(leaf);
+            free(split);
+            return false;
+        }
+
+        split->prefix_len = (uint8_t)matched;
+        memcpy(split->prefix, node->prefix, (size_t)matched);
+        split->count = node->count + 1;
+
+        uint8_t old_byte = node->prefix[matched];
+        node->prefix_len = (uint8_t)(node->prefix_len - matched - 1);
+        memmove(node->prefix, node->prefix + matched + 1, node->prefix_len);
+
+        add_child(&split, old_byte, node);
+        add_child(&split, key_byte(key, depth + matched), leaf);
+        *ref = split;
+        return true;
+    }
+
+    depth += node->prefix_len;
+    ARTNode** child = find_child(node, key_byte(key, depth));
+    if (child) {
+        if (!insert_recursive(child, key, depth + 1)) return false;
+        node->count++;
+        return true;
+    }
+
+    ARTNode* leaf = create_leaf(key);
+    if (!leaf) return false;
+    if (!add_child(ref, key_byte(key, depth), leaf)) {
+        free(leaf);
+        return false;
+    }
+    (*ref)->count++;
+    return true;
+}
+
+bool art_insert(ART* tree, int value) {
+    if (!tree) return false;
+
+    bool success = insert_recursive(&tree->root, encode_key(value), 0);
+    if (success) tree->size++;
+    return success;
+}
+
+static bool delete_recursive(ARTNode** ref, uint32_t key, int depth) {
+    ARTNode* node = *ref;
+    if (!node) return false;
+
+    if (is_leaf(node)) {
+        if (leaf_key(node) != key) return false;
+        free(node);
+        *ref = NULL;
+        return true;
+    }
+
+    if (prefix_match(node, key, depth) < node->prefix_len) return false;
+    depth += node->prefix_len;
+
+    uint8_t byte = key_byte(key, depth);
+    ARTNode** child = find_child(node, byte);
+    if (!child || !delete_recursive(child, key, depth + 1)) return false;
+
+    node->count--;
+    if (!*child) remove_child(ref, byte);
+    return true;
+}
+
+bool art_delete(ART* tree, int value) {
+    if (!tree || !tree->root) return false;
+
+    bool success = delete_recursive(&tree->root, encode_key(value), 0);
+    if (success) tree->size--;
+    return success;
+}
+
+// ==================== SEARCH OPERATIONS ====================
+
+bool art_search(const ART* tree, int value) {
+    if (!tree) return false;
+
+    uint32_t key = encode_key(value);
+    ARTNode* node = tree->root;
+    int depth = 0;
+
+    while (node) {
+        if (is_leaf(node)) return leaf_key(node) == key;
+        if (prefix_match(node, key, depth) < node->prefix_len) return false;
+
+        depth += node->prefix_len;
+        ARTNode** child = find_child(node, key_byte(key, depth));
+        node = child ? *child : NULL;
+        depth++;
+    }
+    return false;
+}
+
+bool art_contains(const ART* tree, int value) {
+    return art_search(tree, value);
+}
+
+// ==================== TRAVERSAL OPERATIONS ====================
+
+typedef struct {
+    void (*callback)(int);
+    uint32_t low;
+    uint32_t high;
+    uint32_t base;                       // Key bits fixed above the child
+    int depth;                           // Byte position of the child
+} RangeContext;
+
+static void range_recursive(ARTNode* node, RangeContext* ctx);
+
+static bool range_visit(uint8_t byte, ARTNode* child, void* arg) {
+    RangeContext* ctx = (RangeContext*)arg;
+
+    int shift = 24 - 8 * ctx->depth;
+    uint32_t sub_low = ctx->base | ((uint32_t)byte << shift);
+    uint32_t sub_high = sub_low | (uint32_t)(((uint64_t)1 << shift) - 1);
+
+    if (sub_high < ctx->low) return true;
+    if (sub_low > ctx->high) return false;
+
+    RangeContext child_ctx = *ctx;
+    child_ctx.base = sub_low;
+    child_ctx.depth = ctx->depth + 1;
+    range_recursive(child, &child_ctx);
+    return true;
+}
+
+static void range_recursive(ARTNode* node, RangeContext* ctx) {
+    if (is_leaf(node)) {
+        uint32_t key = leaf_key(node);
+        if (key >= ctx->low && key <= ctx->high) ctx->callback(decode_key(key));
+        return;
+    }
+
+    RangeContext inner = *ctx;
+    for (int i = 0; i < node->prefix_len; i++) {
+        inner.base |= (uint32_t)node->prefix[i] << (24 - 8 * (inner.depth + i));
+    }
+    inner.depth += node->prefix_len;
+    for_each_child(node, range_visit, &inner);
+}
+
+void art_range(const ART* tree, int low, int high, void (*callback)(int)) {
+    if (!tree || !tree->root || !callback || low > high) return;
+
+    RangeContext ctx = { callback, encode_key(low), encode_key(high), 0, 0 };
+    range_recursive(tree->root, &ctx);
+}
+
+void art_inorder(const ART* tree, void (*callback)(int)) {
+    art_range(tree, INT_MIN, INT_MAX, callback);
+}
+
+// ==================== UTILITY OPERATIONS ====================
+
+int art_min(const ART* tree) {
+    if (!tree || !tree->root) {
+        fprintf(stderr, "Tree is empty\n");
+        return INT_MIN;
+    }
+
+    ARTNode* node = tree->root;
+    while (!is_leaf(node)) node = first_child(node);
+    return decode_key(leaf_key(node));
+}
+
+int art_max(const ART* tree) {
+    if (!tree || !tree->root) {
+        fprintf(stderr, "Tree is empty\n");
+        return INT_MAX;
+    }
+
+    ARTNode* node = tree->root;
+    while (!is_leaf(node)) node = last_child(node);
+    return decode_key(leaf_key(node));
+}
+
+int art_size(const ART* tree) {
+    return tree ? tree->size : 0;
+}
+
+bool art_is_empty(const ART* tree) {
+    return !tree || !tree->root;
+}
+
+// ==================== ADVANCED OPERATIONS ====================
+
+typedef struct {
+    int k;                               // Remaining rank to skip
+    ARTNode* found;
+} KthContext;
+
+static bool kth_visit(uint8_t byte, ARTNode* child, void* arg) {
+    (void)byte;
+    KthContext* ctx = (KthContext*)arg;
+
+    int count = node_count(child);
+    if (ctx->k > count) {
+        ctx->k -= count;
+        return true;
+    }
+    ctx->found = child;
+    return false;
+}
+
+int art_kth_smallest(const ART* tree, int k) {
+    if (!tree || k <= 0 || k > tree->size) {
+        fprintf(stderr, "Invalid k value\n");
+        return -1;
+    }
+
+    // Skip whole subtrees using their key counts
+    KthContext ctx = { k, tree->root };
+    while (!is_leaf(ctx.found)) {
+        ARTNode* node = ctx.found;
+        for_each_child(node, kth_visit, &ctx);
+    }
+    return decode_key(leaf_key(ctx.found));
+}
+
+int art_kth_largest(const ART* tree, int k) {
+    if (!tree || k <= 0 || k > tree->size) {
+        fprintf(stderr, "Invalid k value\n");
+        return -1;
+    }
+    return art_kth_smallest(tree, tree->size - k + 1);
+}
+
+typedef struct {
+    uint8_t byte;                        // Stop at the child for this byte
+    int below;                           // Keys under smaller bytes
+} RankContext;
+
+static bool rank_visit(uint8_t byte, ARTNode* child, void* arg) {
+    RankContext* ctx = (RankContext*)arg;
+    if (byte >= ctx->byte) return false;
+    ctx->below += node_count(child);
+    return true;
+}
+
+int art_rank(const ART* tree, int value) {
+    if (!tree) return 0;
+
+    uint32_t key = encode_key(value);
+    ARTNode* node = tree->root;
+    int depth = 0;
+    int rank = 0;
+
+    while (node) {
+        if (is_leaf(node)) return rank + (leaf_key(node) < key ? 1 : 0);
+
+        int matched = prefix_match(node, key, depth);
+        if (matched < node->prefix_len) {
+            // The whole subtree lies on one side of the key
+            if (node->prefix[matched] < key_byte(key, depth + matched)) {
+                rank += node->count;
+            }
+            return rank;
+        }
+
+        depth += node->prefix_len;
+        RankContext ctx = { key_byte(key, depth), 0 };
+        for_each_child(node, rank_visit, &ctx);
+        rank += ctx.below;
+
+        ARTNode** child = find_child(node, ctx.byte);
+        node = child ? *child : NULL;
+        depth++;
+    }
+    return rank;
+}
+
+int art_count_range(const ART* tree, int low, int high) {
+    if (!tree || low > high) return 0;
+
+    int below_high = art_rank(tree, high) + (art_search(tree, high) ? 1 : 0);
+    return below_high - art_rank(tree, low);
+}
@@ -6,15 +6,30 @@
 #include "bst.h"
 #include <assert.h>
 #include <string.h>
+#include <math.h>
+#include <stdatomic.h>
+#include <time.h>
 
 // ==================== INTERNAL HELPER FUNCTIONS ====================
 
-static BSTNode* create_node(int value) {
-    BSTNode* node = (BSTNode*)malloc(sizeof(BSTNode));
+// Node layout used while subtree hashing is enabled. Plain trees never pay
+// for the digest.
+typedef struct {
+    BSTNode node;
+    uint64_t digest;            // Hash of the keys in this subtree
+} HashedNode;
+
+static size_t node_size(const BST* tree) {
+    return tree->hashed ? sizeof(HashedNode) : sizeof(BSTNode);
+}
+
+static BSTNode* create_node(int value, size_t size) {
+    BSTNode* node = (BSTNode*)malloc(size);
     if (!node) return NULL;
     
     node->data = value;
     node->left = node->right = NULL;
+    node->parent = NULL;
     return node;
 }
 
@@ -29,6 +44,299 @@ static int max_int(int a, int b) {
     return (a > b) ? a : b;
 }
 
+static BSTNode* subtree_min(BSTNode* root) {
+    while (root && root->left) root = root->left;
+    return root;
+}
+
+static BSTNode* subtree_max(BSTNode* root) {
+    while (root && root->right) root = root->right;
+    return root;
+}
+
+// Replace the subtree rooted at old_node with the one rooted at new_node
+static void transplant(BST* tree, BSTNode* old_node, BSTNode* new_node) {
+    if (!old_node->parent) {
+        tree->root = new_node;
+    } else if (old_node == old_node->parent->left) {
+        old_node->parent->left = new_node;
+    } else {
+        old_node->parent->right = new_node;
+    }
+    if (new_node) new_node->parent = old_node->parent;
+}
+
+// ==================== MEMBERSHIP FILTER HELPERS ====================
+
+#define FILTER_BLOCK_BYTES 64       // One filter block per cache line
+#define FILTER_BLOCK_COUNTERS 128   // 4-bit counters per block
+#define FILTER_COUNTER_MAX 15
+#define FILTER_MAX_HASHES 8
+#define FILTER_MAX_COUNTERS_PER_KEY 8192
+
+// Blocked counting Bloom filter. Every key maps to a single cache-line block
+// of 4-bit counters, so a membership probe touches one cache line. Counters
+// saturate at 15 and are then never decremented, which keeps deletions safe.
+// The lookup counters are atomic so concurrent read-only searches stay
+// race-free.
+struct BSTFilter {
+    uint64_t* blocks;           // Counter blocks, cache-line aligned
+    size_t num_blocks;
+    int num_hashes;             // Counters touched per key
+    int capacity;               // Number of keys the filter was sized for
+    double target_fpr;          // Requested false-positive rate
+    atomic_ullong lookups;      // Lookups that probed the filter
+    atomic_ullong rejected;     // Lookups answered by the filter
+    atomic_ullong false_positives; // Passed the filter but missed
+};
+
+static uint64_t mix64(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+// Pick the block for value and fill probes with counter indices inside it
+static uint64_t* filter_block(const BSTFilter* filter, int value,
+                              int probes[FILTER_MAX_HASHES]) {
+    uint64_t h = mix64((uint32_t)value);
+    size_t block = (size_t)(((h >> 32) * (uint64_t)filter->num_blocks) >> 32);
+    
+    uint64_t bits = mix64(h);
+    for (int i = 0; i < filter->num_hashes; i++) {
+        int probe = (int)(bits & (FILTER_BLOCK_COUNTERS - 1));
+        bits >>= 7;
+        
+        // Keep probes distinct so every hash checks its own counter
+        for (int j = 0; j < i; j++) {
+            if (probes[j] == probe) {
+                probe = (probe + 1) & (FILTER_BLOCK_COUNTERS - 1);
+                j = -1;
+            }
+        }
+        probes[i] = probe;
+    }
+    return filter->blocks + block * (FILTER_BLOCK_BYTES / sizeof(uint64_t));
+}
+
+static int counter_get(const uint64_t* block, int index) {
+    return (int)((block[index >> 4] >> ((index & 15) * 4)) & 0xF);
+}
+
+static void counter_add(uint64_t* block, int index, int delta) {
+    int count = counter_get(block, index);
+    
+    // Saturated counters are sticky: their true count is unknown
+    if (count == FILTER_COUNTER_MAX) return;
+    if (delta < 0 && count == 0) return;
+    
+    uint64_t unit = (uint64_t)1 << ((index & 15) * 4);
+    if (delta > 0) {
+        block[index >> 4] += unit;
+    } else {
+        block[index >> 4] -= unit;
+    }
+}
+
+static void filter_update(BSTFilter* filter, int value, int delta) {
+    if (!filter) return;
+    
+    int probes[FILTER_MAX_HASHES];
+    uint64_t* block = filter_block(filter, value, probes);
+    for (int i = 0; i < filter->num_hashes; i++) {
+        counter_add(block, probes[i], delta);
+    }
+}
+
+static bool filter_may_contain(const BSTFilter* filter, int value) {
+    int probes[FILTER_MAX_HASHES];
+    const uint64_t* block = filter_block(filter, value, probes);
+    for (int i = 0; i < filter->num_hashes; i++) {
+        if (counter_get(block, probes[i]) == 0) return false;
+    }
+    return true;
+}
+
+static void filter_reset(BSTFilter* filter) {
+    if (!filter) return;
+    memset(filter->blocks, 0, filter->num_blocks * FILTER_BLOCK_BYTES);
+}
+
+// Expected false-positive rate of a blocked filter holding keys keys. The
+// number of keys landing in a block is Poisson distributed, each key sets
+// num_hashes distinct counters of its block, and a miss is a false positive
+// when all of its own num_hashes counters are set.
+static double blocked_fpr(double keys, double num_blocks, int num_hashes) {
+    if (keys <= 0.0) return 0.0;
+    
+    double load = keys / num_blocks;
+    double untouched = 1.0 - (double)num_hashes / FILTER_BLOCK_COUNTERS;
+    double spread = 12.0 * sqrt(load) + 20.0;
+    int first = load > spread ? (int)(load - spread) : 0;
+    int last = (int)(load + spread);
+    
+    // Poisson terms are evaluated in log space so heavy loads do not underflow
+    double fpr = 0.0;
+    for (int j = first; j <= last; j++) {
+        double term = exp(j * log(load) - load - lgamma(j + 1.0));
+        double set = 1.0 - pow(untouched, (double)j);
+        fpr += term * pow(set, num_hashes);
+    }
+    return fpr;
+}
+
+// Fewest blocks for which num_hashes probes meet target_fpr, or 0 if the
+// target cannot be reached within FILTER_MAX_COUNTERS_PER_KEY
+static size_t blocks_for_target(int capacity, int num_hashes, double target_fpr) {
+    double limit = (double)capacity * FILTER_MAX_COUNTERS_PER_KEY /
+                   FILTER_BLOCK_COUNTERS;
+    size_t high = 1;
+    while (blocked_fpr(capacity, (double)high, num_hashes) > target_fpr) {
+        if ((double)high > limit) return 0;
+        high *= 2;
+    }
+    
+    size_t low = high / 2 + 1;
+    if (high == 1) return 1;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (blocked_fpr(capacity, (double)mid, num_hashes) > target_fpr) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return high;
+}
+
+// Returns false when the filter proves value is absent
+static bool filter_check(const BST* tree, int value) {
+    BSTFilter* filter = tree->filter;
+    if (!filter) return true;
+    
+    atomic_fetch_add_explicit(&filter->lookups, 1, memory_order_relaxed);
+    if (filter_may_contain(filter, value)) return true;
+    
+    atomic_fetch_add_explicit(&filter->rejected, 1, memory_order_relaxed);
+    return false;
+}
+
+// Record a lookup that passed the filter but found nothing
+static void filter_record_miss(const BST* tree) {
+    if (tree->filter) {
+        atomic_fetch_add_explicit(&tree->filter->false_positives, 1,
+                                  memory_order_relaxed);
+    }
+}
+
+// ==================== SUBTREE HASH HELPERS ====================
+
+// Per-process key for the digests, so that colliding key sets cannot be
+// chosen in advance. Zero means not yet drawn.
+static atomic_ullong digest_seed;
+
+static void init_digest_seed(void) {
+    if (atomic_load(&digest_seed)) return;
+    
+    // Not cryptographic: the clocks and the (randomized) addresses of a
+    // local and of the seed itself differ from run to run
+    int local = 0;
+    uint64_t seed = mix64((uint64_t)time(NULL) ^ ((uint64_t)clock() << 32));
+    seed = mix64(seed ^ (uint64_t)(uintptr_t)&local);
+    seed = mix64(seed ^ (uint64_t)(uintptr_t)&digest_seed) | 1;
+    
+    unsigned long long unset = 0;
+    atomic_compare_exchange_strong(&digest_seed, &unset, seed);
+}
+
+static uint64_t key_digest(int value) {
+    return mix64((uint32_t)value + atomic_load_explicit(&digest_seed,
+                                                        memory_order_relaxed));
+}
+
+// Only valid for nodes of a hashed tree
+static uint64_t* node_digest(const BSTNode* node) {
+    return &((HashedNode*)node)->digest;
+}
+
+static uint64_t subtree_digest(const BSTNode* root) {
+    return root ? *node_digest(root) : 0;
+}
+
+static uint64_t compute_digests(BSTNode* root) {
+    if (!root) return 0;
+    *node_digest(root) = key_digest(root->data) + compute_digests(root->left) +
+                         compute_digests(root->right);
+    return *node_digest(root);
+}
+
+// Recompute digests from node up to the root after a structural change
+static void refresh_digests(const BST* tree, BSTNode* node) {
+    if (!tree->hashed) return;
+    for (; node; node = node->parent) {
+        *node_digest(node) = key_digest(node->data) + subtree_digest(node->left) +
+                             subtree_digest(node->right);
+    }
+}
+
+// Digest of the keys strictly below bound
+static uint64_t digest_below(const BSTNode* root, long long bound) {
+    uint64_t digest = 0;
+    while (root) {
+        if (root->data < bound) {
+            digest += key_digest(root->data) + subtree_digest(root->left);
+            root = root->right;
+        } else {
+            root = root->left;
+        }
+    }
+    return digest;
+}
+
+// Digest of the keys strictly between low and high
+static uint64_t digest_range(const BSTNode* root, long long low, long long high) {
+    return digest_below(root, high) - digest_below(root, low + 1);
+}
+
+// Reallocate node with a new layout and relink everything pointing at it.
+// Returns the moved node, or NULL (leaving node intact) on failure.
+static BSTNode* resize_node(BST* tree, BSTNode* node, size_t size) {
+    BSTNode* parent = node->parent;
+    bool is_left = parent && parent->left == node;
+    bool is_finger = tree->finger == node;
+    bool is_min = tree->min_node == node;
+    bool is_max = tree->max_node == node;
+    
+    BSTNode* moved = (BSTNode*)realloc(node, size);
+    if (!moved) return NULL;
+    
+    if (!parent) {
+        tree->root = moved;
+    } else if (is_left) {
+        parent->left = moved;
+    } else {
+        parent->right = moved;
+    }
+    if (moved->left) moved->left->parent = moved;
+    if (moved->right) moved->right->parent = moved;
+    if (is_finger) tree->finger = moved;
+    if (is_min) tree->min_node = moved;
+    if (is_max) tree->max_node = moved;
+    return moved;
+}
+
+static bool resize_all_nodes(BST* tree, size_t size) {
+    for (BSTNode* node = subtree_min(tree->root); node;
+         node = bst_node_successor(node)) {
+        node = resize_node(tree, node, size);
+        if (!node) return false;
+    }
+    return true;
+}
+
 // ==================== TREE CREATION & DESTRUCTION ====================
 
 BST* bst_create() {
@@ -37,12 +345,18 @@ BST* bst_create() {
     
     tree->root = NULL;
     tree->size = 0;
+    tree->finger = NULL;
+    tree->min_node = NULL;
+    tree->max_node = NULL;
+    tree->filter = NULL;
+    tree->hashed = false;
     return tree;
 }
 
 void bst_destroy(BST* tree) {
     if (!tree) return;
     bst_clear(tree);
+    bst_filter_disable(tree);
     free(tree);
 }
 
@@ -51,6 +365,10 @@ void bst_clear(BST* tree) {
     destroy_subtree(tree->root);
     tree->root = NULL;
     tree->size = 0;
+    tree->finger = NULL;
+    tree->min_node = NULL;
+    tree->max_node = NULL;
+    filter_reset(tree->filter);
 }
 
 // ==================== INSERTION OPERATIONS ====================
@@ -74,10 +392,11 @@ bool bst_insert(BST* tree, int value) {
     }
     
     // Create new node
-    BSTNode* newNode = create_node(value);
+    BSTNode* newNode = create_node(value, node_size(tree));
     if (!newNode) return false;
     
     // Insert node
+    newNode->parent = parent;
     if (!parent) {
         tree->root = newNode; // Empty tree
     } else if (value < parent->data) {
@@ -86,31 +405,29 @@ bool bst_insert(BST* tree, int value) {
         parent->right = newNode;
     }
     
+    tree->finger = newNode;
+    refresh_digests(tree, newNode);
+    if (!tree->min_node || value < tree->min_node->data) tree->min_node = newNode;
+    if (!tree->max_node || value > tree->max_node->data) tree->max_node = newNode;
+    filter_update(tree->filter, value, 1);
     tree->size++;
     return true;
 }
 
-bool bst_insert_recursive(BST* tree, int value) {
-    if (!tree) return false;
-    
-    bool success = false;
-    tree->root = bst_insert_node(tree->root, value, &success);
-    
-    if (success) tree->size++;
-    return success;
-}
-
-BSTNode* bst_insert_node(BSTNode* root, int value, int* success) {
+static BSTNode* insert_node_sized(BSTNode* root, int value, int* success,
+                                  size_t size) {
     if (!root) {
-        BSTNode* node = create_node(value);
+        BSTNode* node = create_node(value, size);
         if (node && success) *success = true;
         return node;
     }
     
     if (value < root->data) {
-        root->left = bst_insert_node(root->left, value, success);
+        root->left = insert_node_sized(root->left, value, success, size);
+        if (root->left) root->left->parent = root;
     } else if (value > root->data) {
-        root->right = bst_insert_node(root->right, value, success);
+        root->right = insert_node_sized(root->right, value, success, size);
+        if (root->right) root->right->parent = root;
     } else {
         if (success) *success = false; // Duplicate
     }
@@ -118,16 +435,128 @@ BSTNode* bst_insert_node(BSTNode* root, int value, int* success) {
     return root;
 }
 
+bool bst_insert_recursive(BST* tree, int value) {
+    if (!tree) return false;
+    
+    int success = 0;
+    tree->root = insert_node_sized(tree->root, value, &success, node_size(tree));
+    
+    if (success) {
+        tree->root->parent = NULL;
+        refresh_digests(tree, bst_find_node(tree->root, value));
+        if (!tree->min_node || value < tree->min_node->data) {
+            tree->min_node = subtree_min(tree->root);
+        }
+        if (!tree->max_node || value > tree->max_node->data) {
+            tree->max_node = subtree_max(tree->root);
+        }
+        filter_update(tree->filter, value, 1);
+        tree->size++;
+    }
+    return success;
+}
+
+BSTNode* bst_insert_node(BSTNode* root, int value, int* success) {
+    return insert_node_sized(root, value, success, sizeof(BSTNode));
+}
+
 // ==================== DELETION OPERATIONS ====================
 
 bool bst_delete(BST* tree, int value) {
     if (!tree || !tree->root) return false;
     
-    bool success = false;
-    tree->root = bst_delete_node(tree->root, value, &success);
+    BSTNode* node = bst_find_node(tree->root, value);
+    if (!node) return false;
     
-    if (success) tree->size--;
-    return success;
+    if (node == tree->min_node) tree->min_node = bst_node_successor(node);
+    if (node == tree->max_node) tree->max_node = bst_node_predecessor(node);
+    
+    // Splice the node out instead of copying data, so that pointers to
+    // other nodes (such as the finger) stay valid
+    BSTNode* changed = node->parent; // Lowest node whose subtree changed
+    if (!node->left) {
+        transplant(tree, node, node->right);
+    } else if (!node->right) {
+        transplant(tree, node, node->left);
+    } else {
+        BSTNode* successor = subtree_min(node->right);
+        changed = successor;
+        if (successor->parent != node) {
+            changed = successor->parent;
+            transplant(tree, successor, successor->right);
+            successor->right = node->right;
+            successor->right->parent = successor;
+        }
+        transplant(tree, node, successor);
+        successor->left = node->left;
+        successor->left->parent = successor;
+    }
+    refresh_digests(tree, changed);
+    
+    // Keep the finger close to the removed key
+    if (tree->finger == node) {
+        tree->finger = node->parent ? node->parent : tree->root;
+    }
+    
+    free(node);
+    filter_update(tree->filter, value, -1);
+    tree->size--;
+    return true;
+}
+
+// Remove up to n extreme keys in one pass. The extreme node never has a
+// child on its own side, so each step is a single splice followed by a
+// short walk to the next extreme node.
+static int pop_extremes(BST* tree, int* out, int n, bool smallest) {
+    if (!tree || n <= 0) return 0;
+    
+    BSTNode* node = smallest ? tree->min_node : tree->max_node;
+    int popped = 0;
+    
+    while (node && popped < n) {
+        BSTNode* inner = smallest ? node->right : node->left;
+        BSTNode* next = node->parent;
+        if (inner) next = smallest ? subtree_min(inner) : subtree_max(inner);
+        
+        transplant(tree, node, inner);
+        if (tree->finger == node) tree->finger = next;
+        filter_update(tree->filter, node->data, -1);
+        if (out) out[popped] = node->data;
+        
+        free(node);
+        popped++;
+        node = next;
+    }
+    
+    if (smallest) {
+        tree->min_node = node;
+    } else {
+        tree->max_node = node;
+    }
+    if (!tree->root) tree->min_node = tree->max_node = NULL;
+    
+    // Every surviving ancestor of a popped node lies on the path from the
+    // new extreme node to the root, so refreshing that path is enough
+    if (popped) refresh_digests(tree, node);
+    
+    tree->size -= popped;
+    return popped;
+}
+
+int bst_pop_min_n(BST* tree, int* out, int n) {
+    return pop_extremes(tree, out, n, true);
+}
+
+int bst_pop_max_n(BST* tree, int* out, int n) {
+    return pop_extremes(tree, out, n, false);
+}
+
+bool bst_remove_min(BST* tree, int* min_value) {
+    return pop_extremes(tree, min_value, 1, true) == 1;
+}
+
+bool bst_remove_max(BST* tree, int* max_value) {
+    return pop_extremes(tree, max_value, 1, false) == 1;
 }
 
 BSTNode* bst_delete_node(BSTNode* root, int value, bool* success) {
@@ -138,8 +567,10 @@ BSTNode* bst_delete_node(BSTNode* root, int value, bool* success) {
     
     if (value < root->data) {
         root->left = bst_delete_node(root->left, value, success);
+        if (root->left) root->left->parent = root;
     } else if (value > root->data) {
         root->right = bst_delete_node(root->right, value, success);
+        if (root->right) root->right->parent = root;
     } else {
         // Node found
         if (success) *success = true;
@@ -147,10 +578,12 @@ BSTNode* bst_delete_node(BSTNode* root, int value, bool* success) {
         // Case 1: No child or one child
         if (!root->left) {
             BSTNode* temp = root->right;
+            if (temp) temp->parent = root->parent;
             free(root);
             return temp;
         } else if (!root->right) {
             BSTNode* temp = root->left;
+            temp->parent = root->parent;
             free(root);
             return temp;
         }
@@ -167,6 +600,7 @@ BSTNode* bst_delete_node(BSTNode* root, int value, bool* success) {
         
         // Delete the successor
         root->right = bst_delete_node(root->right, successor->data, NULL);
+        if (root->right) root->right->parent = root;
     }
     
     return root;
@@ -176,7 +610,11 @@ BSTNode* bst_delete_node(BSTNode* root, int value, bool* success) {
 
 bool bst_search(const BST* tree, int value) {
     if (!tree) return false;
-    return bst_find_node(tree->root, value) != NULL;
+    if (!filter_check(tree, value)) return false;
+    
+    if (bst_find_node(tree->root, value)) return true;
+    filter_record_miss(tree);
+    return false;
 }
 
 BSTNode* bst_find_node(const BSTNode* root, int value) {
@@ -196,6 +634,221 @@ bool bst_contains(const BST* tree, int value) {
     return bst_search(tree, value);
 }
 
+// Climb from the finger to the lowest ancestor whose subtree can hold value.
+// Only the bound on the side of value is checked: ancestors reached through
+// the other side lie even further away and are skipped.
+//
+// A finger search costs the climb to the lowest common ancestor of the
+// finger and the target plus the descent from there. That is O(1) amortized
+// over a sequential scan, but a single lookup can still climb the full depth
+// (a finger just left of the root searching for the root), and the tree is
+// not rebalanced, so there is no O(log d) bound.
+static BSTNode* finger_climb(BSTNode* node, int value) {
+    while (node && value != node->data) {
+        BSTNode* child = node;
+        if (value < node->data) {
+            while (child->parent && child == child->parent->left) {
+                child = child->parent;
+            }
+            if (!child->parent || value > child->parent->data) return node;
+        } else {
+            while (child->parent && child == child->parent->right) {
+                child = child->parent;
+            }
+            if (!child->parent || value < child->parent->data) return node;
+        }
+        node = child->parent;
+    }
+    return node;
+}
+
+BSTNode* bst_finger_find(BST* tree, int value) {
+    if (!tree || !tree->root) return NULL;
+    if (!filter_check(tree, value)) return NULL;
+    
+    BSTNode* current = tree->finger ? finger_climb(tree->finger, value)
+                                    : tree->root;
+    BSTNode* last = current;
+    
+    while (current) {
+        last = current;
+        if (value == current->data) {
+            break;
+        } else if (value < current->data) {
+            current = current->left;
+        } else {
+            current = current->right;
+        }
+    }
+    
+    // Misses move the finger too, so that nearby lookups stay cheap
+    tree->finger = last;
+    if (!current) filter_record_miss(tree);
+    return current;
+}
+
+bool bst_finger_search(BST* tree, int value) {
+    return bst_finger_find(tree, value) != NULL;
+}
+
+// ==================== MEMBERSHIP FILTER ====================
+
+bool bst_filter_enable(BST* tree, int capacity, double target_fpr) {
+    if (!tree || target_fpr <= 0.0 || target_fpr >= 1.0) return false;
+    if (capacity < tree->size) capacity = tree->size;
+    if (capacity < 1) capacity = 1;
+    
+    // The textbook Bloom formulas ignore blocking and the cap on hashes, so
+    // size with the blocked model instead: take the hash count that meets
+    // the target with the fewest blocks
+    size_t num_blocks = 0;
+    int num_hashes = 0;
+    for (int k = 1; k <= FILTER_MAX_HASHES; k++) {
+        size_t blocks = blocks_for_target(capacity, k, target_fpr);
+        if (blocks && (!num_blocks || blocks < num_blocks)) {
+            num_blocks = blocks;
+            num_hashes = k;
+        }
+    }
+    if (!num_blocks) return false;
+    
+    BSTFilter* filter = (BSTFilter*)calloc(1, sizeof(BSTFilter));
+    if (!filter) return false;
+    
+    filter->blocks = (uint64_t*)aligned_alloc(FILTER_BLOCK_BYTES,
+                                              num_blocks * FILTER_BLOCK_BYTES);
+    if (!filter->blocks) {
+        free(filter);
+        return false;
+    }
+    filter->num_blocks = num_blocks;
+    filter->num_hashes = num_hashes;
+    filter->capacity = capacity;
+    filter->target_fpr = target_fpr;
+    atomic_init(&filter->lookups, 0);
+    atomic_init(&filter->rejected, 0);
+    atomic_init(&filter->false_positives, 0);
+    filter_reset(filter);
+    
+    // Populate from the keys already in the tree
+    for (BSTNode* node = subtree_min(tree->root); node;
+         node = bst_node_successor(node)) {
+        filter_update(filter, node->data, 1);
+    }
+    
+    bst_filter_disable(tree);
+    tree->filter = filter;
+    return true;
+}
+
+void bst_filter_disable(BST* tree) {
+    if (!tree || !tree->filter) return;
+    free(tree->filter->blocks);
+    free(tree->filter);
+    tree->filter = NULL;
+}
+
+bool bst_filter_stats(const BST* tree, BSTFilterStats* stats) {
+    if (!tree || !tree->filter || !stats) return false;
+    
+    BSTFilter* filter = tree->filter;
+    unsigned long long lookups = atomic_load_explicit(&filter->lookups,
+                                                      memory_order_relaxed);
+    unsigned long long rejected = atomic_load_explicit(&filter->rejected,
+                                                       memory_order_relaxed);
+    unsigned long long false_positives =
+        atomic_load_explicit(&filter->false_positives, memory_order_relaxed);
+    unsigned long long misses = rejected + false_positives;
+    
+    stats->memory_bytes = filter->num_blocks * FILTER_BLOCK_BYTES;
+    stats->num_hashes = filter->num_hashes;
+    stats->capacity = filter->capacity;
+    stats->target_fpr = filter->target_fpr;
+    stats->estimated_fpr = blocked_fpr(tree->size, (double)filter->num_blocks,
+                                       filter->num_hashes);
+    stats->observed_fpr = misses ? (double)false_positives / misses : 0.0;
+    stats->lookups = lookups;
+    stats->rejected = rejected;
+    stats->false_positives = false_positives;
+    return true;
+}
+
+// ==================== ORDER QUERIES ====================
+
+// Largest node below value (or equal to it when inclusive)
+static BSTNode* lower_node(const BSTNode* root, int value, bool inclusive) {
+    const BSTNode* best = NULL;
+    while (root) {
+        if (root->data < value || (inclusive && root->data == value)) {
+            best = root;
+            root = root->right;
+        } else {
+            root = root->left;
+        }
+    }
+    return (BSTNode*)best;
+}
+
+// Smallest node above value (or equal to it when inclusive)
+static BSTNode* upper_node(const BSTNode* root, int value, bool inclusive) {
+    const BSTNode* best = NULL;
+    while (root) {
+        if (root->data > value || (inclusive && root->data == value)) {
+            best = root;
+            root = root->left;
+        } else {
+            root = root->right;
+        }
+    }
+    return (BSTNode*)best;
+}
+
+static bool node_result(const BSTNode* node, int* result) {
+    if (!node) return false;
+    if (result) *result = node->data;
+    return true;
+}
+
+bool bst_floor(const BST* tree, int value, int* result) {
+    if (!tree) return false;
+    return node_result(lower_node(tree->root, value, true), result);
+}
+
+bool bst_ceiling(const BST* tree, int value, int* result) {
+    if (!tree) return false;
+    return node_result(upper_node(tree->root, value, true), result);
+}
+
+bool bst_predecessor(const BST* tree, int value, int* result) {
+    if (!tree) return false;
+    return node_result(lower_node(tree->root, value, false), result);
+}
+
+bool bst_successor(const BST* tree, int value, int* result) {
+    if (!tree) return false;
+    return node_result(upper_node(tree->root, value, false), result);
+}
+
+BSTNode* bst_node_predecessor(const BSTNode* node) {
+    if (!node) return NULL;
+    if (node->left) return subtree_max(node->left);
+    
+    while (node->parent && node == node->parent->left) {
+        node = node->parent;
+    }
+    return node->parent;
+}
+
+BSTNode* bst_node_successor(const BSTNode* node) {
+    if (!node) return NULL;
+    if (node->right) return subtree_min(node->right);
+    
+    while (node->parent && node == node->parent->right) {
+        node = node->parent;
+    }
+    return node->parent;
+}
+
 // ==================== TRAVERSAL OPERATIONS ====================
 
 static void inorder_recursive(BSTNode* root, void (*callback)(int)) {
@@ -310,12 +963,7 @@ int bst_min(const BST* tree) {
         fprintf(stderr, "Tree is empty\n");
         return INT_MIN;
     }
-    
-    BSTNode* current = tree->root;
-    while (current->left) {
-        current = current->left;
-    }
-    return current->data;
+    return tree->min_node->data;
 }
 
 int bst_max(const BST* tree) {
@@ -323,12 +971,7 @@ int bst_max(const BST* tree) {
         fprintf(stderr, "Tree is empty\n");
         return INT_MAX;
     }
-    
-    BSTNode* current = tree->root;
-    while (current->right) {
-        current = current->right;
-    }
-    return current->data;
+    return tree->max_node->data;
 }
 
 static int height_recursive(BSTNode* root) {
@@ -350,7 +993,8 @@ bool bst_is_empty(const BST* tree) {
     return !tree || !tree->root;
 }
 
-static bool is_valid_recursive(BSTNode* root, int min, int max) {
+// Bounds are exclusive and wider than int, so INT_MIN and INT_MAX are valid keys
+static bool is_valid_recursive(BSTNode* root, long long min, long long max) {
     if (!root) return true;
     
     if (root->data <= min || root->data >= max) {
@@ -363,7 +1007,7 @@ static bool is_valid_recursive(BSTNode* root, int min, int max) {
 
 bool bst_is_valid(const BST* tree) {
     if (!tree) return true;
-    return is_valid_recursive(tree->root, INT_MIN, INT_MAX);
+    return is_valid_recursive(tree->root, LLONG_MIN, LLONG_MAX);
 }
 
 // ==================== ADVANCED OPERATIONS ====================
@@ -416,3 +1060,149 @@ void bst_print_range(const BST* tree, int low, int high) {
                       ^(int value) { printf("%d ", value); });
     printf("\n");
 }
+
+// Height of a height-balanced subtree, or -2 as soon as any node is unbalanced
+static int balanced_height(BSTNode* root) {
+    if (!root) return -1;
+    
+    int left = balanced_height(root->left);
+    if (left == -2) return -2;
+    int right = balanced_height(root->right);
+    if (right == -2) return -2;
+    
+    if (abs(left - right) > 1) return -2;
+    return 1 + max_int(left, right);
+}
+
+bool bst_is_balanced(const BST* tree) {
+    if (!tree) return true;
+    return balanced_height(tree->root) != -2;
+}
+
+bool bst_equals(const BST* tree1, const BST* tree2) {
+    if (!tree1 || !tree2) return tree1 == tree2;
+    if (tree1->size != tree2->size) return false;
+    
+    // Equal key sets have equal root digests, whatever the tree shapes
+    if (tree1->hashed && tree2->hashed) {
+        return subtree_digest(tree1->root) == subtree_digest(tree2->root);
+    }
+    
+    const BSTNode* a = tree1->min_node;
+    const BSTNode* b = tree2->min_node;
+    while (a && b) {
+        if (a->data != b->data) return false;
+        a = bst_node_successor(a);
+        b = bst_node_successor(b);
+    }
+    return !a && !b;
+}
+
+// ==================== SUBTREE HASHES ====================
+
+bool bst_hash_enable(BST* tree) {
+    if (!tree) return false;
+    
+    // Move every node to the layout that carries a digest
+    if (!tree->hashed && !resize_all_nodes(tree, sizeof(HashedNode))) {
+        resize_all_nodes(tree, sizeof(BSTNode));
+        return false;
+    }
+    
+    init_digest_seed();
+    tree->hashed = true;
+    compute_digests(tree->root);
+    return true;
+}
+
+void bst_hash_disable(BST* tree) {
+    if (!tree || !tree->hashed) return;
+    
+    // Shrinking cannot lose data; a failed realloc only leaves nodes too large
+    tree->hashed = false;
+    resize_all_nodes(tree, sizeof(BSTNode));
+}
+
+uint64_t bst_hash(const BST* tree) {
+    if (!tree || !tree->hashed) return 0;
+    return subtree_digest(tree->root);
+}
+
+typedef struct {
+    void (*callback)(int, bool, void*);
+    void* ctx;
+    int count;
+} DiffContext;
+
+static void report_diff(DiffContext* diff, int value, bool in_first) {
+    if (diff->callback) diff->callback(value, in_first, diff->ctx);
+    diff->count++;
+}
+
+// Report the keys of root strictly between low and high
+static void report_range(const BSTNode* root, long long low, long long high,
+                         bool in_first, DiffContext* diff) {
+    long long first = low + 1;
+    if (first > INT_MAX) return;
+    if (first < INT_MIN) first = INT_MIN;
+    
+    for (BSTNode* node = upper_node(root, (int)first, true);
+         node && node->data < high; node = bst_node_successor(node)) {
+        report_diff(diff, node->data, in_first);
+    }
+}
+
+// Compare the subtree of tree1 rooted at node, which holds exactly the keys
+// of tree1 in (low, high), against the keys of tree2 in the same range.
+// other is carried down as the lowest node of tree2 whose subtree holds all
+// of tree2's keys in the range, so lookups start there instead of at the
+// root. Ranges whose digests match are skipped without being visited.
+//
+// Each visited node of tree1 costs O(h2) in tree2, and the visited nodes are
+// the root paths to the d differences, so a diff costs O(d * h1 * h2).
+static void diff_recursive(const BSTNode* node, long long low, long long high,
+                           const BSTNode* other, DiffContext* diff) {
+    while (other && (other->data <= low || other->data >= high)) {
+        other = other->data <= low ? other->right : other->left;
+    }
+    
+    if (subtree_digest(node) == digest_range(other, low, high)) return;
+    
+    if (!node) {
+        report_range(other, low, high, false, diff);
+        return;
+    }
+    
+    if (!bst_find_node(other, node->data)) report_diff(diff, node->data, true);
+    diff_recursive(node->left, low, node->data, other, diff);
+    diff_recursive(node->right, node->data, high, other, diff);
+}
+
+int bst_diff(const BST* tree1, const BST* tree2,
+             void (*callback)(int, bool, void*), void* ctx) {
+    if (!tree1 || !tree2) return -1;
+    
+    DiffContext diff = { callback, ctx, 0 };
+    
+    if (tree1->hashed && tree2->hashed) {
+        diff_recursive(tree1->root, LLONG_MIN, LLONG_MAX, tree2->root, &diff);
+        return diff.count;
+    }
+    
+    // Without digests, merge the two sorted sequences
+    const BSTNode* a = tree1->min_node;
+    const BSTNode* b = tree2->min_node;
+    while (a || b) {
+        if (b && (!a || b->data < a->data)) {
+            report_diff(&diff, b->data, false);
+            b = bst_node_successor(b);
+        } else if (a && (!b || a->data < b->data)) {
+            report_diff(&diff, a->data, true);
+            a = bst_node_successor(a);
+        } else {
+            a = bst_node_successor(a);
+            b = bst_node_successor(b);
+        }
+    }
+    return diff.count;
+}
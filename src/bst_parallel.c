@@ -0,0 +1,511 @@
+/**
+ * @file bst_parallel.c
+ * @brief Parallel traversals and reductions over a Binary Search Tree
+ *
+ * Every worker owns a deque of subtree tasks. A worker walks its current
+ * subtree with an explicit stack and, whenever its deque runs dry, moves the
+ * shallowest pending subtree onto the deque where idle workers can steal it
+ * (lazy binary splitting). This adapts to skewed trees, where a fixed split
+ * depth would leave most workers idle.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "bst.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifndef BST_PARALLEL_CUTOFF
+#define BST_PARALLEL_CUTOFF 4096   ///< Trees smaller than this run sequentially
+#endif
+
+#ifndef BST_PARALLEL_GRAIN
+#define BST_PARALLEL_GRAIN 256     ///< Nodes visited between two task splits
+#endif
+
+#ifndef BST_PARALLEL_REALLOC
+#define BST_PARALLEL_REALLOC realloc  ///< Allocator for stacks and deques
+#else
+void* BST_PARALLEL_REALLOC(void* ptr, size_t size);
+#endif
+
+typedef struct {
+    BSTNode* node;
+    int depth;                  // Depth of node in the whole tree
+    long long low;              // Exclusive lower bound for node->data
+    long long high;             // Exclusive upper bound for node->data
+    int index;                  // Result slot for frontier tasks
+} Task;
+
+typedef struct {
+    Task* items;
+    int head;                   // Thieves take from here
+    int tail;                   // Owner pushes and pops here
+    int capacity;
+    atomic_int size;
+    pthread_mutex_t lock;
+} TaskDeque;
+
+struct ParallelJob;
+
+typedef struct {
+    TaskDeque deque;
+    struct ParallelJob* job;
+    Task* stack;                // Pending subtrees of the current task
+    int stack_base;
+    int stack_top;
+    int stack_capacity;
+    int since_split;
+    unsigned int seed;
+    long long acc;              // Per-worker reduction result
+    int max_depth;
+    pthread_t thread;
+} Worker;
+
+typedef struct ParallelJob {
+    Worker* workers;
+    int num_workers;
+    atomic_long pending;        // Tasks created but not yet finished
+    atomic_bool abort;
+    atomic_bool failed;
+    bool split;                 // Walk below each task, or only visit its root
+    bool (*visit)(Worker*, const Task*);
+
+    void (*callback)(int, void*);
+    long long (*map)(int, void*);
+    long long (*combine)(long long, long long);
+    void* ctx;
+    int* results;
+    int height_budget;
+} ParallelJob;
+
+// ==================== TASK DEQUE ====================
+
+static bool deque_init(TaskDeque* dq) {
+    dq->items = NULL;
+    dq->head = dq->tail = dq->capacity = 0;
+    atomic_init(&dq->size, 0);
+    return pthread_mutex_init(&dq->lock, NULL) == 0;
+}
+
+static void deque_destroy(TaskDeque* dq) {
+    free(dq->items);
+    pthread_mutex_destroy(&dq->lock);
+}
+
+static bool deque_push(TaskDeque* dq, Task task) {
+    pthread_mutex_lock(&dq->lock);
+
+    if (dq->tail == dq->capacity && dq->head > 0) {
+        // Reclaim stolen slots before growing
+        int count = dq->tail - dq->head;
+        memmove(dq->items, dq->items + dq->head, (size_t)count * sizeof(Task));
+        dq->head = 0;
+        dq->tail = count;
+    }
+
+    if (dq->tail == dq->capacity) {
+        int capacity = dq->capacity ? dq->capacity * 2 : 64;
+        Task* items = (Task*)BST_PARALLEL_REALLOC(dq->items, (size_t)capacity * sizeof(Task));
+        if (!items) {
+            pthread_mutex_unlock(&dq->lock);
+            return false;
+        }
+        dq->items = items;
+        dq->capacity = capacity;
+    }
+
+    dq->items[dq->tail++] = task;
+    atomic_store(&dq->size, dq->tail - dq->head);
+    pthread_mutex_unlock(&dq->lock);
+    return true;
+}
+
+static bool deque_take(TaskDeque* dq, Task* task, bool steal) {
+    if (atomic_load(&dq->size) == 0) return false;
+
+    pthread_mutex_lock(&dq->lock);
+    bool found = dq->head < dq->tail;
+    if (found) {
+        *task = steal ? dq->items[dq->head++] : dq->items[--dq->tail];
+        if (dq->head == dq->tail) dq->head = dq->tail = 0;
+    }
+    atomic_store(&dq->size, dq->tail - dq->head);
+    pthread_mutex_unlock(&dq->lock);
+    return found;
+}
+
+// ==================== WORKERS ====================
+
+static bool stack_push(Worker* w, Task task) {
+    if (w->stack_top == w->stack_capacity) {
+        int capacity = w->stack_capacity ? w->stack_capacity * 2 : 64;
+        Task* stack = (Task*)BST_PARALLEL_REALLOC(w->stack, (size_t)capacity * sizeof(Task));
+        if (!stack) return false;
+        w->stack = stack;
+        w->stack_capacity = capacity;
+    }
+    w->stack[w->stack_top++] = task;
+    return true;
+}
+
+static void fail_job(ParallelJob* job) {
+    atomic_store(&job->failed, true);
+    atomic_store(&job->abort, true);
+}
+
+// Hand the shallowest pending subtree to thieves when our deque is empty
+static void maybe_split(Worker* w) {
+    ParallelJob* job = w->job;
+
+    if (w->stack_top - w->stack_base < 2) return;
+    if (++w->since_split < BST_PARALLEL_GRAIN) return;
+    if (atomic_load(&w->deque.size) > 0) return;
+
+    atomic_fetch_add(&job->pending, 1);
+    if (!deque_push(&w->deque, w->stack[w->stack_base])) {
+        atomic_fetch_sub(&job->pending, 1);
+        return;
+    }
+    w->stack_base++;
+    w->since_split = 0;
+}
+
+static void process_task(Worker* w, Task task) {
+    ParallelJob* job = w->job;
+
+    if (!job->split) {
+        if (!job->visit(w, &task)) atomic_store(&job->abort, true);
+        return;
+    }
+
+    w->stack_base = w->stack_top = 0;
+    if (!stack_push(w, task)) {
+        fail_job(job);
+        return;
+    }
+
+    while (w->stack_top > w->stack_base && !atomic_load(&job->abort)) {
+        Task current = w->stack[--w->stack_top];
+        if (!job->visit(w, &current)) {
+            atomic_store(&job->abort, true);
+            break;
+        }
+
+        BSTNode* node = current.node;
+        if (node->right) {
+            Task right = { node->right, current.depth + 1,
+                           node->data, current.high, 0 };
+            if (!stack_push(w, right)) fail_job(job);
+        }
+        if (node->left) {
+            Task left = { node->left, current.depth + 1,
+                          current.low, node->data, 0 };
+            if (!stack_push(w, left)) fail_job(job);
+        }
+        maybe_split(w);
+    }
+}
+
+static bool steal_task(Worker* w, Task* task) {
+    ParallelJob* job = w->job;
+    int n = job->num_workers;
+    if (n < 2) return false;
+
+    int start = (int)(rand_r(&w->seed) % (unsigned int)n);
+    for (int i = 0; i < n; i++) {
+        Worker* victim = &job->workers[(start + i) % n];
+        if (victim != w && deque_take(&victim->deque, task, true)) return true;
+    }
+    return false;
+}
+
+static void* worker_loop(void* arg) {
+    Worker* w = (Worker*)arg;
+    ParallelJob* job = w->job;
+
+    while (!atomic_load(&job->abort)) {
+        Task task;
+        if (deque_take(&w->deque, &task, false) || steal_task(w, &task)) {
+            process_task(w, task);
+            atomic_fetch_sub(&job->pending, 1);
+        } else if (atomic_load(&job->pending) == 0) {
+            break;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static int resolve_threads(const BST* tree, int num_threads) {
+    if (tree->size < BST_PARALLEL_CUTOFF) return 1;
+    if (num_threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = cpus > 0 ? (int)cpus : 1;
+    }
+    return num_threads;
+}
+
+// Run job over the given initial tasks; false if it could not complete
+static bool run_job(ParallelJob* job, const Task* tasks, int num_tasks,
+                    int num_workers, long long identity) {
+    job->workers = (Worker*)calloc((size_t)num_workers, sizeof(Worker));
+    if (!job->workers) return false;
+
+    job->num_workers = 0;
+    atomic_init(&job->pending, num_tasks);
+    atomic_init(&job->abort, false);
+    atomic_init(&job->failed, false);
+
+    for (int i = 0; i < num_workers; i++) {
+        Worker* w = &job->workers[i];
+        if (!deque_init(&w->deque)) {
+            fail_job(job);
+            break;
+        }
+        w->job = job;
+        w->seed = (unsigned int)i * 2654435761u + 1;
+        w->acc = identity;
+        w->max_depth = -1;
+        job->num_workers++;
+    }
+    if (job->num_workers == 0) return false;
+
+    // Deal the initial tasks round-robin
+    for (int i = 0; i < num_tasks && !atomic_load(&job->abort); i++) {
+        Worker* w = &job->workers[i % job->num_workers];
+        if (!deque_push(&w->deque, tasks[i])) fail_job(job);
+    }
+
+    int started = 1;
+    for (; started < job->num_workers && !atomic_load(&job->abort); started++) {
+        Worker* w = &job->workers[started];
+        if (pthread_create(&w->thread, NULL, worker_loop, w) != 0) break;
+    }
+
+    worker_loop(&job->workers[0]);
+    for (int i = 1; i < started; i++) {
+        pthread_join(job->workers[i].thread, NULL);
+    }
+
+    return !atomic_load(&job->failed);
+}
+
+static void release_job(ParallelJob* job) {
+    for (int i = 0; i < job->num_workers; i++) {
+        deque_destroy(&job->workers[i].deque);
+        free(job->workers[i].stack);
+    }
+    free(job->workers);
+}
+
+static bool run_tree_job(ParallelJob* job, const BST* tree, int num_threads,
+                         long long identity) {
+    Task root = { tree->root, 0, LLONG_MIN, LLONG_MAX, 0 };
+    job->split = true;
+    return run_job(job, &root, 1, resolve_threads(tree, num_threads), identity);
+}
+
+// ==================== VISITORS ====================
+
+static bool visit_for_each(Worker* w, const Task* task) {
+    w->job->callback(task->node->data, w->job->ctx);
+    return true;
+}
+
+static bool visit_reduce(Worker* w, const Task* task) {
+    ParallelJob* job = w->job;
+    w->acc = job->combine(w->acc, job->map(task->node->data, job->ctx));
+    return true;
+}
+
+static bool visit_height(Worker* w, const Task* task) {
+    if (task->depth > w->max_depth) w->max_depth = task->depth;
+    return true;
+}
+
+static bool visit_valid(Worker* w, const Task* task) {
+    (void)w;
+    long long value = task->node->data;
+    return value > task->low && value < task->high;
+}
+
+// Height of a balanced subtree, or -2 when unbalanced or deeper than budget
+static int bounded_balanced_height(const BSTNode* root, int budget) {
+    if (!root) return -1;
+    if (budget < 0) return -2;
+
+    int left = bounded_balanced_height(root->left, budget - 1);
+    if (left == -2) return -2;
+    int right = bounded_balanced_height(root->right, budget - 1);
+    if (right == -2) return -2;
+
+    if (abs(left - right) > 1) return -2;
+    return 1 + (left > right ? left : right);
+}
+
+static bool visit_balanced(Worker* w, const Task* task) {
+    ParallelJob* job = w->job;
+    int height = bounded_balanced_height(task->node,
+                                         job->height_budget - task->depth);
+    job->results[task->index] = height;
+    return height != -2;
+}
+
+// ==================== PARALLEL OPERATIONS ====================
+
+// A failed job cannot be redone sequentially without repeating callbacks,
+// so the caller is told instead
+bool bst_parallel_for_each(const BST* tree, void (*callback)(int, void*),
+                           void* ctx, int num_threads) {
+    if (!tree || !callback) return false;
+    if (!tree->root) return true;
+
+    ParallelJob job = { 0 };
+    job.visit = visit_for_each;
+    job.callback = callback;
+    job.ctx = ctx;
+    bool completed = run_tree_job(&job, tree, num_threads, 0);
+    release_job(&job);
+    return completed;
+}
+
+long long bst_parallel_reduce(const BST* tree, long long identity,
+                              long long (*map)(int, void*),
+                              long long (*combine)(long long, long long),
+                              void* ctx, int num_threads) {
+    if (!tree || !tree->root || !map || !combine) return identity;
+
+    ParallelJob job = { 0 };
+    job.visit = visit_reduce;
+    job.map = map;
+    job.combine = combine;
+    job.ctx = ctx;
+
+    long long result = identity;
+    if (run_tree_job(&job, tree, num_threads, identity)) {
+        for (int i = 0; i < job.num_workers; i++) {
+            result = combine(result, job.workers[i].acc);
+        }
+    } else {
+        // Fall back to a sequential walk
+        BSTNode* node = tree->root;
+        while (node->left) node = node->left;
+        for (; node; node = bst_node_successor(node)) {
+            result = combine(result, map(node->data, ctx));
+        }
+    }
+    release_job(&job);
+    return result;
+}
+
+int bst_parallel_height(const BST* tree, int num_threads) {
+    if (!tree || !tree->root) return -1;
+
+    ParallelJob job = { 0 };
+    job.visit = visit_height;
+
+    int height = -1;
+    if (run_tree_job(&job, tree, num_threads, 0)) {
+        for (int i = 0; i < job.num_workers; i++) {
+            if (job.workers[i].max_depth > height) height = job.workers[i].max_depth;
+        }
+    } else {
+        height = bst_height(tree);
+    }
+    release_job(&job);
+    return height;
+}
+
+bool bst_parallel_is_valid(const BST* tree, int num_threads) {
+    if (!tree || !tree->root) return true;
+
+    ParallelJob job = { 0 };
+    job.visit = visit_valid;
+
+    bool valid;
+    if (run_tree_job(&job, tree, num_threads, 0)) {
+        valid = !atomic_load(&job.abort);
+    } else {
+        valid = bst_is_valid(tree);
+    }
+    release_job(&job);
+    return valid;
+}
+
+// Collect the nodes at depth target in preorder
+static void collect_frontier(BSTNode* root, int depth, int target,
+                             Task* tasks, int* count) {
+    if (!root) return;
+    if (depth == target) {
+        Task task = { root, depth, 0, 0, *count };
+        tasks[(*count)++] = task;
+        return;
+    }
+    collect_frontier(root->left, depth + 1, target, tasks, count);
+    collect_frontier(root->right, depth + 1, target, tasks, count);
+}
+
+// Combine frontier results above depth target, in the same preorder
+static int combine_frontier(const BSTNode* root, int depth, int target,
+                            const int* results, int* index) {
+    if (!root) return -1;
+    if (depth == target) return results[(*index)++];
+
+    int left = combine_frontier(root->left, depth + 1, target, results, index);
+    int right = combine_frontier(root->right, depth + 1, target, results, index);
+    if (left == -2 || right == -2 || abs(left - right) > 1) return -2;
+    return 1 + (left > right ? left : right);
+}
+
+bool bst_parallel_is_balanced(const BST* tree, int num_threads) {
+    if (!tree || !tree->root) return true;
+
+    int num_workers = resolve_threads(tree, num_threads);
+
+    // A height-balanced tree of n nodes is at most ~1.44 log2(n) high, so
+    // deeper paths prove imbalance and bound the recursion below
+    int bits = 0;
+    while (bits < 31 && (tree->size >> bits) > 0) bits++;
+    int budget = bits * 3 / 2 + 2;
+
+    // Cut the tree at a depth that yields a few tasks per worker
+    int target = 0;
+    while ((1 << target) < 8 * num_workers && target < 20) target++;
+    if (target > budget) target = budget;
+
+    Task* tasks = (Task*)malloc(((size_t)1 << target) * sizeof(Task));
+    int* results = (int*)malloc(((size_t)1 << target) * sizeof(int));
+    if (!tasks || !results) {
+        free(tasks);
+        free(results);
+        return bst_is_balanced(tree);
+    }
+
+    int count = 0;
+    collect_frontier(tree->root, 0, target, tasks, &count);
+
+    ParallelJob job = { 0 };
+    job.visit = visit_balanced;
+    job.results = results;
+    job.height_budget = budget;
+    job.split = false;
+
+    bool balanced;
+    if (run_job(&job, tasks, count, num_workers, 0)) {
+        int index = 0;
+        balanced = !atomic_load(&job.abort) &&
+                   combine_frontier(tree->root, 0, target, results, &index) != -2;
+    } else {
+        balanced = bst_is_balanced(tree);
+    }
+
+    release_job(&job);
+    free(tasks);
+    free(results);
+    return balanced;
+}
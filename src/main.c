@@ -4,6 +4,8 @@
  */
 
 #include "bst.h"
+#include "art.h"
+#include <string.h>
 #include <time.h>
 
 // Callback function for traversals
@@ -126,6 +128,89 @@ void example_performance() {
     bst_destroy(tree);
 }
 
+static double elapsed_ms(clock_t start) {
+    return (double)(clock() - start) * 1000 / CLOCKS_PER_SEC;
+}
+
+static void benchmark_engines(const char* label, const int* keys, int n) {
+    int* probes = (int*)malloc(n * sizeof(int));
+    if (!probes) return;
+    memcpy(probes, keys, n * sizeof(int));
+    
+    BST* bst = bst_create();
+    ART* art = art_create();
+    clock_t start;
+    int found = 0;
+    
+    printf("\n%s keys (%d):\n", label, n);
+    
+    start = clock();
+    for (int i = 0; i < n; i++) bst_insert(bst, keys[i]);
+    printf("  BST insert : %8.2f ms\n", elapsed_ms(start));
+    
+    start = clock();
+    for (int i = 0; i < n; i++) art_insert(art, keys[i]);
+    printf("  ART insert : %8.2f ms\n", elapsed_ms(start));
+    
+    // Even probes are hits; odd probes are shifted past the dense range, so
+    // they always miss there and almost always miss on sparse keys
+    for (int i = 1; i < n; i += 2) {
+        probes[i] = (int)((unsigned)probes[i] + (unsigned)n);
+    }
+    
+    start = clock();
+    for (int i = 0; i < n; i++) found += bst_search(bst, probes[i]);
+    printf("  BST search : %8.2f ms\n", elapsed_ms(start));
+    
+    start = clock();
+    for (int i = 0; i < n; i++) found -= art_search(art, probes[i]);
+    printf("  ART search : %8.2f ms\n", elapsed_ms(start));
+    
+    // Duplicate keys leave the trees smaller than n
+    int step = bst_size(bst) / 200;
+    
+    start = clock();
+    for (int k = 1; k <= 200; k++) bst_kth_smallest(bst, k * step);
+    printf("  BST kth    : %8.2f ms (200 queries)\n", elapsed_ms(start));
+    
+    start = clock();
+    for (int k = 1; k <= 200; k++) art_kth_smallest(art, k * step);
+    printf("  ART kth    : %8.2f ms (200 queries)\n", elapsed_ms(start));
+    
+    if (found != 0) printf("  Engines disagree!\n");
+    
+    bst_destroy(bst);
+    art_destroy(art);
+    free(probes);
+}
+
+// Example 4: BST vs Adaptive Radix Tree
+void example_engine_comparison() {
+    printf("\n=== Example 4: BST vs ART ===\n");
+    
+    const int n = 100000;
+    int* keys = (int*)malloc(n * sizeof(int));
+    if (!keys) return;
+    
+    // Dense: a shuffled permutation of 0..n-1
+    for (int i = 0; i < n; i++) keys[i] = i;
+    for (int i = n - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        int tmp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = tmp;
+    }
+    benchmark_engines("Dense", keys, n);
+    
+    // Sparse: random values spread over the whole int range
+    for (int i = 0; i < n; i++) {
+        keys[i] = (int)(((unsigned)rand() << 16) ^ (unsigned)rand());
+    }
+    benchmark_engines("Sparse", keys, n);
+    
+    free(keys);
+}
+
 int main() {
     printf("=== Binary Search Tree Implementation ===\n");
     printf("Author: [Your Name]\n");
@@ -135,6 +220,7 @@ int main() {
     example_basic_operations();
     example_advanced_operations();
     example_performance();
+    example_engine_comparison();
     
     printf("\n=== Program Completed Successfully ===\n");
     return 0;
@@ -0,0 +1,132 @@
+/**
+ * @file test_art.c
+ * @brief Unit Tests for Adaptive Radix Tree Implementation
+ */
+
+#include "art.h"
+#include "bst.h"
+#include <assert.h>
+#include <stdio.h>
+
+static int collected[4096];
+static int collected_count = 0;
+
+static void collect_value(int value) {
+    collected[collected_count++] = value;
+}
+
+void test_create_destroy() {
+    printf("Testing create/destroy... ");
+    ART* tree = art_create();
+    assert(tree != NULL);
+    assert(art_is_empty(tree));
+    assert(art_size(tree) == 0);
+    art_destroy(tree);
+    printf("PASS\n");
+}
+
+void test_insert_search_delete() {
+    printf("Testing insert/search/delete... ");
+    ART* tree = art_create();
+
+    assert(art_insert(tree, 50) == true);
+    assert(art_insert(tree, -30) == true);
+    assert(art_insert(tree, 70000) == true);
+    assert(art_insert(tree, -30) == false); // Duplicate
+    assert(art_insert(tree, INT_MIN) == true);
+    assert(art_insert(tree, INT_MAX) == true);
+
+    assert(art_size(tree) == 5);
+    assert(art_search(tree, -30) == true);
+    assert(art_search(tree, INT_MIN) == true);
+    assert(art_search(tree, 51) == false);
+    assert(art_min(tree) == INT_MIN);
+    assert(art_max(tree) == INT_MAX);
+
+    assert(art_delete(tree, 50) == true);
+    assert(art_delete(tree, 50) == false);
+    assert(art_search(tree, 50) == false);
+    assert(art_size(tree) == 4);
+
+    art_destroy(tree);
+    printf("PASS\n");
+}
+
+void test_node_growth() {
+    printf("Testing node growth and shrinking... ");
+    ART* tree = art_create();
+
+    // Dense keys fill Node256 nodes, deletes shrink them back
+    for (int i = 0; i < 3000; i++) {
+        assert(art_insert(tree, i) == true);
+    }
+    for (int i = 0; i < 3000; i += 2) {
+        assert(art_delete(tree, i) == true);
+    }
+    for (int i = 0; i < 3000; i++) {
+        assert(art_search(tree, i) == (i % 2 == 1));
+    }
+    for (int i = 1; i < 3000; i += 2) {
+        assert(art_delete(tree, i) == true);
+    }
+    assert(art_is_empty(tree));
+
+    art_destroy(tree);
+    printf("PASS\n");
+}
+
+void test_ordered_queries() {
+    printf("Testing ordered queries against BST... ");
+    ART* art = art_create();
+    BST* bst = bst_create();
+
+    srand(42);
+    for (int i = 0; i < 2000; i++) {
+        int value = rand() - RAND_MAX / 2;
+        assert(art_insert(art, value) == bst_insert(bst, value));
+    }
+    for (int i = 0; i < 500; i++) {
+        int value = rand() - RAND_MAX / 2;
+        art_insert(art, value);
+        bst_insert(bst, value);
+        assert(art_delete(art, value) == bst_delete(bst, value));
+    }
+    assert(art_size(art) == bst_size(bst));
+    assert(art_min(art) == bst_min(bst));
+    assert(art_max(art) == bst_max(bst));
+
+    collected_count = 0;
+    art_inorder(art, collect_value);
+    assert(collected_count == art_size(art));
+    for (int k = 1; k <= collected_count; k++) {
+        assert(art_kth_smallest(art, k) == collected[k - 1]);
+        assert(art_kth_smallest(art, k) == bst_kth_smallest(bst, k));
+        assert(art_rank(art, collected[k - 1]) == k - 1);
+    }
+    assert(art_kth_largest(art, 1) == art_max(art));
+
+    int low = collected[100];
+    int high = collected[199];
+    assert(art_count_range(art, low, high) == 100);
+
+    collected_count = 0;
+    art_range(art, low, high, collect_value);
+    assert(collected_count == 100);
+    assert(collected[0] == low && collected[99] == high);
+
+    art_destroy(art);
+    bst_destroy(bst);
+    printf("PASS\n");
+}
+
+int main() {
+    printf("\n=== Running ART Unit Tests ===\n\n");
+
+    test_create_destroy();
+    test_insert_search_delete();
+    test_node_growth();
+    test_ordered_queries();
+
+    printf("\n=== All Tests Passed! ===\n");
+    return 0;
+}
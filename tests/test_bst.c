@@ -32,6 +32,11 @@ void test_insert_search() {
     assert(bst_search(tree, 70) == true);
     assert(bst_search(tree, 100) == false);
     
+    assert(bst_insert_recursive(tree, 60) == true);
+    assert(bst_insert_recursive(tree, 60) == false); // Duplicate
+    assert(bst_size(tree) == 4);
+    assert(bst_find_node(tree->root, 60)->parent->data == 70);
+    
     bst_destroy(tree);
     printf("PASS\n");
 }
@@ -105,9 +110,335 @@ void test_utilities() {
     assert(bst_height(tree) == 2);
     assert(bst_is_valid(tree) == true);
     
+    // Extreme keys are valid in both the sequential and parallel checks
+    bst_insert(tree, INT_MIN);
+    bst_insert(tree, INT_MAX);
+    assert(bst_is_valid(tree) == true);
+    assert(bst_parallel_is_valid(tree, 2) == true);
+    
+    bst_destroy(tree);
+    printf("PASS\n");
+}
+
+void test_order_queries() {
+    printf("Testing floor/ceiling/predecessor/successor... ");
+    BST* tree = bst_create();
+    
+    int values[] = {50, 30, 70, 20, 40, 60, 80};
+    for (int i = 0; i < 7; i++) {
+        bst_insert(tree, values[i]);
+    }
+    
+    int result = 0;
+    assert(bst_floor(tree, 45, &result) && result == 40);
+    assert(bst_floor(tree, 40, &result) && result == 40);
+    assert(bst_floor(tree, 10, &result) == false);
+    assert(bst_ceiling(tree, 45, &result) && result == 50);
+    assert(bst_ceiling(tree, 80, &result) && result == 80);
+    assert(bst_ceiling(tree, 90, &result) == false);
+    assert(bst_predecessor(tree, 50, &result) && result == 40);
+    assert(bst_predecessor(tree, 20, &result) == false);
+    assert(bst_successor(tree, 50, &result) && result == 60);
+    assert(bst_successor(tree, 80, &result) == false);
+    
+    BSTNode* node = bst_find_node(tree->root, 20);
+    int expected = 20;
+    while (node) {
+        assert(node->data == expected);
+        node = bst_node_successor(node);
+        expected = node ? expected + 10 : expected;
+    }
+    assert(expected == 80);
+    
+    bst_destroy(tree);
+    printf("PASS\n");
+}
+
+void test_finger_search() {
+    printf("Testing finger search... ");
+    BST* tree = bst_create();
+    
+    for (int i = 0; i < 200; i++) {
+        bst_insert(tree, (i * 37) % 200 * 2);
+    }
+    
+    for (int i = 0; i < 400; i++) {
+        assert(bst_finger_search(tree, i) == (i % 2 == 0));
+    }
+    for (int i = 399; i >= 0; i -= 3) {
+        assert(bst_finger_search(tree, i) == (i % 2 == 0));
+    }
+    
+    // The finger must survive deletions, including of its own node
+    assert(bst_finger_search(tree, 100));
+    assert(bst_delete(tree, 100));
+    assert(bst_delete(tree, 102));
+    assert(bst_finger_search(tree, 100) == false);
+    assert(bst_finger_search(tree, 104));
+    assert(bst_is_valid(tree));
+    
+    bst_destroy(tree);
+    printf("PASS\n");
+}
+
+void test_membership_filter() {
+    printf("Testing membership filter... ");
+    BST* tree = bst_create();
+    
+    for (int i = 0; i < 500; i++) {
+        bst_insert(tree, i * 2);
+    }
+    assert(bst_filter_enable(tree, 1000, 0.01) == true);
+    
+    for (int i = 500; i < 1000; i++) {
+        bst_insert(tree, i * 2);
+    }
+    assert(bst_delete(tree, 10) == true);
+    
+    // The filter must never hide a present key
+    for (int i = 0; i < 1000; i++) {
+        assert(bst_search(tree, i * 2) == (i != 5));
+    }
+    for (int i = 0; i < 1000; i++) {
+        assert(bst_search(tree, i * 2 + 1) == false);
+    }
+    
+    BSTFilterStats stats;
+    assert(bst_filter_stats(tree, &stats) == true);
+    assert(stats.memory_bytes % 64 == 0);    // Whole cache-line blocks
+    assert(stats.lookups == 2000);
+    assert(stats.rejected + stats.false_positives == 1001);
+    assert(stats.observed_fpr < 0.1);
+    
+    bst_clear(tree);
+    assert(bst_search(tree, 20) == false);
+    bst_insert(tree, 20);
+    assert(bst_search(tree, 20) == true);
+    
+    bst_destroy(tree);
+    printf("PASS\n");
+}
+
+void test_priority_queue() {
+    printf("Testing priority-queue mode... ");
+    BST* tree = bst_create();
+    
+    int values[] = {50, 30, 70, 20, 40, 60, 80, 35, 65};
+    for (int i = 0; i < 9; i++) {
+        bst_insert(tree, values[i]);
+    }
+    assert(bst_min(tree) == 20);
+    assert(bst_max(tree) == 80);
+    
+    // Cached extremes follow deletions
+    assert(bst_delete(tree, 20) == true);
+    assert(bst_delete(tree, 80) == true);
+    assert(bst_min(tree) == 30);
+    assert(bst_max(tree) == 70);
+    
+    int value = 0;
+    assert(bst_remove_min(tree, &value) == true && value == 30);
+    assert(bst_remove_max(tree, &value) == true && value == 70);
+    
+    int out[8];
+    assert(bst_pop_min_n(tree, out, 3) == 3);
+    assert(out[0] == 35 && out[1] == 40 && out[2] == 50);
+    assert(bst_min(tree) == 60);
+    assert(bst_pop_max_n(tree, out, 8) == 2);
+    assert(out[0] == 65 && out[1] == 60);
+    assert(bst_is_empty(tree));
+    assert(bst_remove_min(tree, &value) == false);
+    
+    // Batched pops must agree with a sorted order
+    srand(3);
+    for (int i = 0; i < 1000; i++) {
+        bst_insert(tree, rand() % 5000);
+    }
+    int previous = INT_MIN;
+    while (!bst_is_empty(tree)) {
+        int count = bst_pop_min_n(tree, out, 8);
+        for (int i = 0; i < count; i++) {
+            assert(out[i] > previous);
+            previous = out[i];
+        }
+        assert(bst_is_valid(tree));
+        if (!bst_is_empty(tree)) assert(bst_min(tree) > previous);
+    }
+    assert(bst_size(tree) == 0);
+    
+    bst_destroy(tree);
+    printf("PASS\n");
+}
+
+static void record_diff(int value, bool in_first, void* ctx) {
+    int* sums = (int*)ctx;
+    sums[in_first ? 0 : 1] += value;
+}
+
+void test_equals_diff() {
+    printf("Testing hashed equality and diff... ");
+    BST* a = bst_create();
+    BST* b = bst_create();
+    
+    // Same keys, different insertion order and shape
+    for (int i = 0; i < 1000; i++) {
+        bst_insert(a, (i * 7919) % 1000);
+        bst_insert(b, i);
+    }
+    assert(bst_equals(a, b) == true);
+    assert(bst_diff(a, b, NULL, NULL) == 0);
+    
+    assert(bst_hash_enable(a) && bst_hash_enable(b));
+    assert(bst_hash(a) == bst_hash(b));
+    assert(bst_min(a) == 0 && bst_max(a) == 999);
+    assert(bst_is_valid(a) && bst_size(a) == 1000);
+    assert(bst_equals(a, b) == true);
+    
+    // Digests follow inserts, deletes and batched pops
+    bst_delete(a, 500);
+    bst_delete(a, 123);
+    bst_insert(a, 5000);
+    bst_delete(b, 999);
+    assert(bst_equals(a, b) == false);
+    
+    int sums[2] = {0, 0};
+    assert(bst_diff(a, b, record_diff, sums) == 4);
+    assert(sums[0] == 5000 + 999);
+    assert(sums[1] == 500 + 123);
+    
+    int out[4];
+    bst_pop_min_n(a, out, 4);
+    bst_pop_min_n(b, out, 4);
+    bst_insert(a, 500);
+    bst_insert(a, 123);
+    bst_delete(a, 5000);
+    bst_insert(b, 999);
+    assert(bst_hash(a) == bst_hash(b));
+    assert(bst_equals(a, b) == true);
+    
+    // Unhashed trees fall back to a full comparison
+    bst_hash_disable(b);
+    assert(bst_is_valid(b));
+    assert(bst_equals(a, b) == true);
+    assert(bst_insert_recursive(a, 2000) && bst_delete(a, 2000));
+    bst_delete(b, 42);
+    assert(bst_diff(a, b, NULL, NULL) == 1);
+    
+    bst_destroy(a);
+    bst_destroy(b);
+    printf("PASS\n");
+}
+
+static long long identity_map(int value, void* ctx) {
+    (void)ctx;
+    return value;
+}
+
+static long long sum_combine(long long a, long long b) {
+    return a + b;
+}
+
+static void count_value(int value, void* ctx) {
+    (void)value;
+    __atomic_fetch_add((long long*)ctx, 1, __ATOMIC_RELAXED);
+}
+
+void test_parallel() {
+    printf("Testing parallel traversal and reductions... ");
+    BST* tree = bst_create();
+    
+    long long expected = 0;
+    srand(7);
+    for (int i = 0; i < 50000; i++) {
+        int value = rand() % 1000000;
+        if (bst_insert(tree, value)) expected += value;
+    }
+    
+    for (int threads = 1; threads <= 4; threads++) {
+        long long visited = 0;
+        assert(bst_parallel_for_each(tree, count_value, &visited, threads));
+        assert(visited == bst_size(tree));
+        
+        long long sum = bst_parallel_reduce(tree, 0, identity_map,
+                                            sum_combine, NULL, threads);
+        assert(sum == expected);
+        
+        assert(bst_parallel_height(tree, threads) == bst_height(tree));
+        assert(bst_parallel_is_valid(tree, threads) == true);
+        assert(bst_parallel_is_balanced(tree, threads) == bst_is_balanced(tree));
+    }
+    
+    // Break the ordering deep in the tree
+    BSTNode* node = tree->root;
+    while (node->left) node = node->left;
+    node->data = INT_MAX;
+    assert(bst_parallel_is_valid(tree, 4) == false);
+    bst_destroy(tree);
+    
+    // A balanced tree built from sorted midpoints, then a skewed one
+    tree = bst_create();
+    for (int step = 1 << 15; step > 0; step >>= 1) {
+        for (int i = step; i < (1 << 16); i += 2 * step) {
+            bst_insert(tree, i);
+        }
+    }
+    assert(bst_parallel_is_balanced(tree, 4) == true);
+    assert(bst_parallel_height(tree, 4) == 15);
+    bst_insert(tree, 1 << 16);
+    bst_insert(tree, (1 << 16) + 1);
+    assert(bst_parallel_is_balanced(tree, 4) == false);
+    assert(bst_parallel_is_balanced(tree, 4) == bst_is_balanced(tree));
+    
+    bst_destroy(tree);
+    printf("PASS\n");
+}
+
+#ifdef BST_PARALLEL_REALLOC
+// Built with -DBST_PARALLEL_REALLOC=test_realloc, the pool allocates through
+// this hook, which fails the fail_at-th call from now
+static int fail_at = 0;
+
+void* BST_PARALLEL_REALLOC(void* ptr, size_t size) {
+    if (fail_at > 0 && --fail_at == 0) return NULL;
+    return realloc(ptr, size);
+}
+
+void test_parallel_alloc_failure() {
+    printf("Testing parallel allocation failures... ");
+    BST* tree = bst_create();
+    
+    long long expected = 0;
+    srand(11);
+    for (int i = 0; i < 20000; i++) {
+        int value = rand() % 1000000;
+        if (bst_insert(tree, value)) expected += value;
+    }
+    
+    // With one worker, call 1 grows its deque and call 2 its walk stack
+    for (int call = 1; call <= 2; call++) {
+        long long visited = 0;
+        fail_at = call;
+        assert(bst_parallel_for_each(tree, count_value, &visited, 1) == false);
+        assert(visited == 0);
+        
+        fail_at = call;
+        assert(bst_parallel_reduce(tree, 0, identity_map,
+                                   sum_combine, NULL, 1) == expected);
+        fail_at = call;
+        assert(bst_parallel_height(tree, 1) == bst_height(tree));
+        fail_at = call;
+        assert(bst_parallel_is_valid(tree, 1) == true);
+    }
+    
+    fail_at = 0;
+    long long visited = 0;
+    assert(bst_parallel_for_each(tree, count_value, &visited, 1) == true);
+    assert(visited == bst_size(tree));
+    
     bst_destroy(tree);
     printf("PASS\n");
 }
+#endif
 
 int main() {
     printf("\n=== Running BST Unit Tests ===\n\n");
@@ -117,6 +448,15 @@ int main() {
     test_delete();
     test_traversals();
     test_utilities();
+    test_order_queries();
+    test_finger_search();
+    test_membership_filter();
+    test_parallel();
+#ifdef BST_PARALLEL_REALLOC
+    test_parallel_alloc_failure();
+#endif
+    test_priority_queue();
+    test_equals_diff();
     
     printf("\n=== All Tests Passed! ===\n");
     return 0;